@@ -1,12 +1,15 @@
 #include "Engine.h"
 #include "Exceptions/CoreException.h"
-#include "../Graphics/OpenGL/OpenGL.h"
-#include "../Graphics/Vulkan/Vulkan.h"
-#include "../Graphics/IRenderingAPI.h"
+#include "RendererProbe.h"
+#include "MemoryTracker.h"
 #include <iostream>
 #include <thread>
 
 namespace Engine {
+    namespace {
+        const char* RENDERER_PROBE_CACHE = "RendererProbe.cache";
+    }
+
     Engine& Engine::GetInstance() {
         static Engine instance;
         return instance;
@@ -33,34 +36,47 @@ namespace Engine {
     }
 
     void Engine::CheckRenderingAPI() {
-        for(const auto& [renderer, name] : EnumStringMap<Renderer>::values) {
-            {
-                Graphics::IRenderingAPI* api = nullptr;
-
-                switch(renderer) {
-                    case Renderer::OPENGL: {
-                        api = new Graphics::OpenGL::OpenGL();
-                    }
-                    case Renderer::VULKAN: {
-                        api = new Graphics::Vulkan::Vulkan();
-                    }
-                }
+        auto start = std::chrono::high_resolution_clock::now();
 
-                if(api != nullptr) {
-                    if(api->Available()) {
-                        availableRenderers.push_back(renderer);
-                    }
+        const std::string fingerprint = RendererProbe::GetFingerprint();
+        std::vector<ProbeResult> results;
+        bool cached = RendererProbe::Load(RENDERER_PROBE_CACHE, fingerprint, results);
+
+        if(cached) {
+            // Trust the cache for this start, verify it in the background for the next one
+            threadPool->Enqueue([fingerprint, results]() {
+                std::vector<ProbeResult> current = RendererProbe::Run();
+
+                if(current != results) {
+                    std::cout << "[Engine] Renderer capabilities changed, probe cache updated" << std::endl;
+                    RendererProbe::Save(RENDERER_PROBE_CACHE, fingerprint, current);
                 }
+            });
+        } else {
+            results = RendererProbe::Run();
+            RendererProbe::Save(RENDERER_PROBE_CACHE, fingerprint, results);
+        }
+
+        rendererProbes = results;
+        availableRenderers.clear();
+
+        for(const ProbeResult& result : results) {
+            if(result.available) {
+                availableRenderers.push_back(result.renderer);
             }
         }
 
-        std::cout << "AVAILABLE RENDERERS:" << std::endl;
+        rendererCheckTime = std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+
+        std::cout << "AVAILABLE RENDERERS" << (cached ? " (cached)" : "") << ":" << std::endl;
 
-        for(auto& api : availableRenderers) {
-            std::cout << "\t- " << api << std::endl;
+        for(const ProbeResult& result : rendererProbes) {
+            if(result.available) {
+                std::cout << "\t- " << result.renderer << " " << result.version << std::endl;
+            }
         }
 
-        std::cout << "END" << std::endl;
+        std::cout << "END (" << rendererCheckTime << " ms)" << std::endl;
     }
 
     void Engine::Run() {
@@ -133,6 +149,10 @@ namespace Engine {
             threadPool.reset();
         }
 
+        if(MemoryTracker::IsEnabled()) {
+            MemoryTracker::GetInstance().Report();
+        }
+
         isInitialized = false;
     }
 
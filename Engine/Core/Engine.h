@@ -5,6 +5,7 @@
 #include "Settings/Options.h"
 #include "CommandLine/Arguments.h"
 #include "Enum/Renderer.h"
+#include "RendererProbe.h"
 #include <memory>
 #include <stdexcept>
 #include <atomic>
@@ -22,6 +23,8 @@ namespace Engine {
         DEBUGGING               = 1000,
         RENDERER                = 1002,
         VSYNC                   = 1003,
+        RENDER_THREAD           = 1004,
+        LOW_LATENCY             = 1005,
         RESOLUTION_MODE         = 2001,
         RESOLUTION_HEIGHT       = 2002,
         RESOLUTION_WIDTH        = 2003,
@@ -61,6 +64,11 @@ namespace Engine {
                 return shouldStop;
         }
 
+        // The thread pool exists between Initialize and Shutdown
+        bool IsInitialized() const {
+                return isInitialized.load();
+        }
+
         template<typename T>
         void SubscribeToEvent(EventHandler handler) {
             eventDispatcher.Subscribe<T>(handler);
@@ -88,6 +96,11 @@ namespace Engine {
         bool IsFPSLimitEnabled() const { return fpsLimitEnabled; }
         int GetTargetFPS() const { return targetFPS; }
         std::vector<Renderer> GetAvailableRenderers() { return availableRenderers; }
+        const std::vector<ProbeResult>& GetRendererProbes() const { return rendererProbes; }
+
+        // Startup timing in milliseconds
+        float GetStartupTime() const { return startupTime; }
+        float GetRendererCheckTime() const { return rendererCheckTime; }
 
         // Font management
         void RegisterFont(const std::string& name, const std::string& pathToTtf);
@@ -121,6 +134,11 @@ namespace Engine {
 
         // Renderers
         std::vector<Renderer> availableRenderers;
+        std::vector<ProbeResult> rendererProbes;
+
+        // Startup timing
+        float startupTime = 0.0f;
+        float rendererCheckTime = 0.0f;
 
         // Font registry
         std::map<std::string, std::string> m_fontRegistry;
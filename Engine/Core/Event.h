@@ -1,4 +1,5 @@
 #pragma once
+#include "MemoryTracker.h"
 #include <functional>
 #include <memory>
 #include <string>
@@ -64,6 +65,8 @@ namespace Engine {
         }
 
         void Dispatch(const IEvent& event) {
+            MemoryScope memoryScope(MemoryTag::EVENTS);
+
             auto it = handlers.find(event.GetType());
             if (it != handlers.end()) {
                 for (auto& handler : it->second) {
@@ -0,0 +1,142 @@
+#include "FrameArena.h"
+#include "../Graphics/RenderStats.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+namespace Engine {
+    std::atomic<uint64_t> FrameArena::currentFrame{0};
+
+#ifdef NDEBUG
+    std::atomic<bool> FrameArena::poisoning{false};
+#else
+    std::atomic<bool> FrameArena::poisoning{true};
+#endif
+
+    namespace {
+        const unsigned char POISON = 0xDD;
+    }
+
+    FrameArena::FrameArena(size_t initialSize) : blockSize(std::max<size_t>(initialSize, 4096)) {
+        frame = currentFrame.load(std::memory_order_relaxed);
+    }
+
+    FrameArena::~FrameArena() {
+        Release(head);
+    }
+
+    FrameArena& FrameArena::Get() {
+        thread_local FrameArena arena;
+        return arena;
+    }
+
+    void FrameArena::EndFrame() {
+        FrameArena& arena = Get();
+        currentFrame.fetch_add(1, std::memory_order_relaxed);
+        arena.Reset();
+    }
+
+    void FrameArena::Reset() {
+        frame = currentFrame.load(std::memory_order_relaxed);
+
+        if(used > 0) {
+            Graphics::RenderStats::GetInstance().AddArena(used);
+        }
+
+        highWater = std::max(highWater, used);
+        used = 0;
+
+        if(!head) {
+            return;
+        }
+
+        // Several blocks last frame: replace them by one that fits a whole frame
+        if(head->next) {
+            size_t total = capacity;
+            Release(head);
+            head = nullptr;
+            capacity = 0;
+            blockSize = std::max(blockSize, total);
+            AddBlock(blockSize);
+
+            if(poisoning) {
+                std::memset(Data(head), POISON, head->size);
+            }
+
+            return;
+        }
+
+        if(poisoning) {
+            std::memset(Data(head), POISON, head->offset);
+        }
+
+        head->offset = 0;
+    }
+
+    void* FrameArena::do_allocate(size_t bytes, size_t alignment) {
+        if(frame != currentFrame.load(std::memory_order_relaxed)) {
+            Reset();
+        }
+
+        if(head) {
+            // Aligned on the address, the block data itself is only max_align_t aligned
+            uintptr_t start = reinterpret_cast<uintptr_t>(Data(head));
+            size_t offset = ((start + head->offset + alignment - 1) & ~(alignment - 1)) - start;
+
+            if(offset + bytes <= head->size) {
+                head->offset = offset + bytes;
+                used += bytes;
+                return Data(head) + offset;
+            }
+        }
+
+        // Over-aligned requests need the slack in front
+        Block* block = AddBlock(std::max(blockSize, bytes + alignment));
+        size_t offset = (alignment - reinterpret_cast<uintptr_t>(Data(block)) % alignment) % alignment;
+        block->offset = offset + bytes;
+        used += bytes;
+
+        return Data(block) + offset;
+    }
+
+    void FrameArena::do_deallocate(void* pointer, size_t bytes, size_t alignment) {
+        (void) pointer;
+        (void) bytes;
+        (void) alignment;
+    }
+
+    bool FrameArena::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+        return this == &other;
+    }
+
+    FrameArena::Block* FrameArena::AddBlock(size_t minimum) {
+        void* memory = std::malloc(HEADER_SIZE + minimum);
+
+        if(!memory) {
+            throw std::bad_alloc();
+        }
+
+        Block* block    = static_cast<Block*>(memory);
+        block->next     = head;
+        block->size     = minimum;
+        block->offset   = 0;
+
+        head = block;
+        capacity += minimum;
+
+        return block;
+    }
+
+    unsigned char* FrameArena::Data(Block* block) {
+        return reinterpret_cast<unsigned char*>(block) + HEADER_SIZE;
+    }
+
+    void FrameArena::Release(Block* block) {
+        while(block) {
+            Block* next = block->next;
+            std::free(block);
+            block = next;
+        }
+    }
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <memory_resource>
+#include <string>
+#include <vector>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace Engine {
+    /*
+     * Per-thread bump allocator for data that only lives during one frame.
+     * Deallocation is a no-op; everything is released at once when the frame
+     * ends. The ViewManager calls EndFrame after presenting, every other
+     * thread rewinds its arena lazily on its first allocation of a new frame.
+     *
+     * Containers using the arena must not outlive the frame they were
+     * created in.
+     */
+    class FrameArena : public std::pmr::memory_resource {
+        public:
+            FrameArena(size_t initialSize = 64 * 1024);
+            ~FrameArena() override;
+
+            FrameArena(const FrameArena&) = delete;
+            FrameArena& operator=(const FrameArena&) = delete;
+
+            // Arena of the calling thread
+            static FrameArena& Get();
+
+            // Closes the frame: rewinds the calling thread's arena and makes every other one rewind on next use
+            static void EndFrame();
+
+            // Fills released memory with 0xDD so stale frame data shows up immediately (on by default in debug builds)
+            static void SetPoisoning(bool state) { poisoning = state; }
+            static bool IsPoisoning() { return poisoning; }
+
+            void Reset();
+
+            size_t GetUsed() const { return used; }
+            size_t GetCapacity() const { return capacity; }
+            size_t GetHighWater() const { return highWater; }
+
+        protected:
+            void* do_allocate(size_t bytes, size_t alignment) override;
+            void do_deallocate(void* pointer, size_t bytes, size_t alignment) override;
+            bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+        private:
+            struct Block {
+                Block* next;
+                size_t size;
+                size_t offset;
+            };
+
+            // Block data starts max_align_t aligned after the header
+            static constexpr size_t HEADER_SIZE = (sizeof(Block) + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+
+            static unsigned char* Data(Block* block);
+            Block* AddBlock(size_t minimum);
+            void Release(Block* block);
+
+            Block* head         = nullptr;  // Block currently bumped into, older ones follow
+            size_t blockSize;
+            size_t used         = 0;        // Bytes handed out this frame
+            size_t capacity     = 0;
+            size_t highWater    = 0;        // Largest frame so far
+            uint64_t frame      = 0;
+
+            static std::atomic<uint64_t> currentFrame;
+            static std::atomic<bool> poisoning;
+    };
+
+    // Frame-lifetime containers, e.g. FrameString text(&FrameArena::Get());
+    using FrameString = std::pmr::string;
+
+    template<typename T>
+    using FrameVector = std::pmr::vector<T>;
+}
@@ -2,6 +2,8 @@
 #include "Input/InputManager.h"
 #include "Exceptions/CoreException.h"
 #include "../Graphics/OpenGL/OpenGL.h"
+#include "../Graphics/Null/Null.h"
+#include "../Graphics/UI/Text/GlyphAtlas.h"
 #include <iostream>
 #include <thread>
 #include <chrono>
@@ -12,6 +14,10 @@
 #endif
 
 namespace Engine {
+    namespace {
+        const char* GLYPH_ATLAS_CACHE = "GlyphAtlas.cache";
+    }
+
     Game::Game() : Engine(), isInitialized(false) {
         viewManager     = std::make_unique<ViewManager>(this);
         mainWindow      = std::make_shared<NativeWindow>();
@@ -26,6 +32,8 @@ namespace Engine {
             return true;
         }
 
+        startupBegin = std::chrono::high_resolution_clock::now();
+
         SetupEventHandlers();
 
         if(!Engine::Initialize()) {
@@ -97,20 +105,33 @@ namespace Engine {
         }
 
         // Connect InputManager with NativeWindow
-        mainWindow->SetKeyCallback([](int key, int action) {
-            Input::GetInput().OnKeyEvent(key, action);
+        // Bindings show overlays, switch views and change text, so the handlers run where the views are rendered
+        mainWindow->SetKeyCallback([this](int key, int action) {
+            MarkInput();
+            Forward([key, action]() {
+                Input::GetInput().OnKeyEvent(key, action);
+            });
         });
         
-        mainWindow->SetMouseButtonCallback([](int button, int action, float x, float y) {
-            Input::GetInput().OnMouseButtonEvent(button, action, x, y);
+        mainWindow->SetMouseButtonCallback([this](int button, int action, float x, float y) {
+            MarkInput();
+            Forward([button, action, x, y]() {
+                Input::GetInput().OnMouseButtonEvent(button, action, x, y);
+            });
         });
         
-        mainWindow->SetMouseMoveCallback([](float x, float y) {
-            Input::GetInput().OnMouseMoveEvent(x, y);
+        mainWindow->SetMouseMoveCallback([this](float x, float y) {
+            MarkInput();
+            Forward([x, y]() {
+                Input::GetInput().OnMouseMoveEvent(x, y);
+            });
         });
         
-        mainWindow->SetMouseScrollCallback([](float deltaX, float deltaY) {
-            Input::GetInput().OnMouseScrollEvent(deltaX, deltaY);
+        mainWindow->SetMouseScrollCallback([this](float deltaX, float deltaY) {
+            MarkInput();
+            Forward([deltaX, deltaY]() {
+                Input::GetInput().OnMouseScrollEvent(deltaX, deltaY);
+            });
         });
 
         std::string renderer = "OpenGL";
@@ -119,32 +140,50 @@ namespace Engine {
             renderer = GetOption(EngineOption::RENDERER, renderer);
         }
 
-        if(!mainWindow->SetupRenderingContext(renderer)) {
-            std::cout << "[Game] Warning: Failed to setup rendering context for " << renderer << std::endl;
+        // The Null backend draws nothing (CPU benchmarks, call stream comparison)
+        if(renderer == "Null") {
+            auto null = std::make_shared<Graphics::Null::Null>();
+            null->SetHashing(true);
+            renderingAPI = null;
+        } else {
+            if(!mainWindow->SetupRenderingContext(renderer)) {
+                std::cout << "[Game] Warning: Failed to setup rendering context for " << renderer << std::endl;
+            }
+
+            // Create rendering API instance
+            renderingAPI = std::make_shared<Graphics::OpenGL::OpenGL>();
         }
 
-        // Create rendering API instance
-        renderingAPI = std::make_shared<Graphics::OpenGL::OpenGL>();
         if (!renderingAPI->Init(mainWindow)) {
             throw CoreException("Failed to initialize rendering API!");
             return false;
         }
 
+        // Glyphs rasterized in earlier runs go up before the first frame asks for them
+        if(renderer != "Null") {
+            glyphCache = true;
+            Graphics::GlyphAtlas::GetInstance().Load(GLYPH_ATLAS_CACHE);
+        }
+
         // Connect ViewManager to the window and rendering API
         viewManager->SetRenderTarget(mainWindow);
         viewManager->SetRenderingAPI(renderingAPI);
 
         // Set up window resize callback to update view dimensions
+        // Runs on the event thread: views, fonts and the viewport belong to the render thread,
+        // so only the size is handed over and applied at the start of the next frame
         mainWindow->SetResizeCallback([this](int width, int height) {
             std::cout << "[Game] Window resized to: " << width << "x" << height << std::endl;
             if (viewManager) {
-                viewManager->UpdateViewDimensions(width, height);
+                viewManager->RequestResize(width, height);
             }
         });
 
         // Set up window close callback to shutdown the game
         mainWindow->SetCloseCallback([this]() {
-            Exit();
+            Forward([this]() {
+                Exit();
+            });
         });
 
         // Ensure VSync is applied after context setup
@@ -153,8 +192,22 @@ namespace Engine {
             mainWindow->SetVSync(true);
         }
 
+        if(HasOption(EngineOption::RENDER_THREAD)) {
+            renderThreadEnabled = GetOption(EngineOption::RENDER_THREAD, false);
+        }
+
+        if(HasOption(EngineOption::LOW_LATENCY)) {
+            lowLatency = GetOption(EngineOption::LOW_LATENCY, false);
+        }
+
+        viewManager->SetLowLatency(lowLatency);
+
         mainWindow->Show();
         isInitialized = true;
+
+        startupTime = std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - startupBegin).count();
+        std::cout << "[Game] Startup took " << startupTime << " ms (renderer check " << rendererCheckTime << " ms)" << std::endl;
+
         return true;
     }
 
@@ -164,8 +217,9 @@ namespace Engine {
         }
         
         std::cout << "[Game] Exit requested - starting graceful shutdown..." << std::endl;
-        isShuttingDown = true;
+        // Start time first, the main thread reads it once it sees the flag
         shutdownStartTime = std::chrono::steady_clock::now();
+        isShuttingDown = true;
         
         // Show shutdown view if available
         if (viewManager && viewManager->HasView("Shutdown")) {
@@ -201,14 +255,35 @@ namespace Engine {
             hasInputThread = true;
         }
 
+        // Optional render thread: takes over the context, the main thread only pumps events
+        std::thread renderThread;
+
+        if(renderThreadEnabled) {
+            std::cout << "[Game] Rendering on a dedicated thread" << std::endl;
+            mainWindow->ReleaseContext();
+            renderThread = std::thread([this]() {
+                RenderLoop();
+            });
+        }
+
         // Keep main thread for window message pumping AND rendering (OpenGL context requirement)
         while(!shouldStop.load()) {
+            auto frameStart = std::chrono::steady_clock::now();
+
             // Process window events in main thread
             if(mainWindow && mainWindow->IsValid()) {
                 mainWindow->PollEvents();
                 
                 // Update InputManager to handle key state changes
-                Input::GetInput().Update();
+                if(!renderThreadEnabled) {
+                    Input::GetInput().Update();
+                } else if(inputForwarded) {
+                    // Behind this poll's events, so edges are seen by the same frame
+                    viewManager->Post([]() {
+                        Input::GetInput().Update();
+                    });
+                    inputForwarded = false;
+                }
             }
 
             // Check if we should stop after showing shutdown view
@@ -224,9 +299,23 @@ namespace Engine {
                 }
             }
 
+            if(renderThreadEnabled) {
+                // Events only, keep the delay between OS event and forwarding short
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                continue;
+            }
+
             // Render in main thread (OpenGL requirement)
             if(viewManager && mainWindow && mainWindow->IsValid() && renderingAPI) {
-                viewManager->RenderViews(*renderingAPI);
+                if(viewManager->RenderViews(*renderingAPI)) {
+                    MarkPresented();
+                }
+            }
+
+            if(lowLatency) {
+                // Frame deadline instead of a fixed delay, the render time is not added on top
+                std::this_thread::sleep_until(frameStart + std::chrono::milliseconds(16));
+                continue;
             }
 
             // Small sleep for main thread timing
@@ -236,6 +325,31 @@ namespace Engine {
         // Main loop has exited
         std::cout << "[Game] Main loop exited" << std::endl;
 
+        if(renderThread.joinable()) {
+            renderThread.join();
+
+            // Context back to the main thread for cleanup
+            mainWindow->MakeContextCurrent();
+            std::cout << "[Game] Render thread finished" << std::endl;
+        }
+
+        // Pages are read back while the context still exists
+        if(glyphCache) {
+            Graphics::GlyphAtlas::GetInstance().Save(GLYPH_ATLAS_CACHE);
+        }
+
+        if(inputLatency.samples > 0) {
+            std::cout << "[Game] Input to present latency (" << (renderThreadEnabled ? "render thread" : "main thread")
+                      << (lowLatency ? ", low-latency" : "") << "): avg " << GetAverageInputLatency() << " ms, max "
+                      << GetMaxInputLatency() << " ms over " << inputLatency.samples << " frames (OS queue avg "
+                      << GetAverageQueueLatency() << " ms)" << std::endl;
+        }
+
+        if(latchLatency.samples > 0) {
+            std::cout << "[Game] Cursor latch to present: avg " << GetAverageLatchLatency() << " ms, max "
+                      << latchLatency.max << " ms" << std::endl;
+        }
+
         // Wait for threads to finish after stop is requested
         std::cout << "[Game] Waiting for engine thread to finish..." << std::endl;
         if(engineThread.joinable()) {
@@ -267,9 +381,117 @@ namespace Engine {
         OnShutdown();
         std::cout << "[Game] OnShutdown() finished" << std::endl;
 
+        if(auto null = std::dynamic_pointer_cast<Graphics::Null::Null>(renderingAPI)) {
+            null->PrintStatistics();
+        }
+
         Engine::Shutdown();
     }
 
+    void Game::RenderLoop() {
+        mainWindow->MakeContextCurrent();
+
+        while(!shouldStop.load()) {
+            auto frameStart = std::chrono::steady_clock::now();
+
+            if(viewManager && mainWindow->IsValid() && renderingAPI) {
+                if(viewManager->RenderViews(*renderingAPI)) {
+                    MarkPresented();
+                }
+            }
+
+            // Same pacing as the main thread loop (VSync blocks in SwapBuffers anyway)
+            std::this_thread::sleep_until(frameStart + std::chrono::milliseconds(16));
+        }
+
+        mainWindow->ReleaseContext();
+    }
+
+    void Game::MarkInput() {
+        // Time the OS spent queueing the message before it reached us
+        float queued = mainWindow ? mainWindow->GetEventAge() : 0.0f;
+        auto created = std::chrono::steady_clock::now() - std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<float, std::milli>(queued));
+
+        int64_t event = created.time_since_epoch().count();
+        int64_t none = 0;
+
+        // Keep the oldest input that hasn't been presented yet
+        pendingInput.compare_exchange_strong(none, event);
+
+        std::lock_guard<std::mutex> lock(latencyMutex);
+        queueLatency.Add(queued);
+    }
+
+    void Game::Forward(std::function<void()> handler) {
+        if(!renderThreadEnabled || !viewManager) {
+            handler();
+            return;
+        }
+
+        viewManager->Post(std::move(handler));
+        inputForwarded = true;
+    }
+
+    void Game::MarkPresented() {
+        auto now = std::chrono::steady_clock::now();
+        int64_t input = pendingInput.exchange(0);
+
+        if(textReadyTime.load() == 0.0f) {
+            float elapsed = std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - startupBegin).count();
+            bool warm = Graphics::GlyphAtlas::GetInstance().IsLoadedFromCache();
+
+            if(firstFrameTime.load() == 0.0f) {
+                firstFrameTime = elapsed;
+                std::cout << "[Game] First frame after " << elapsed << " ms" << std::endl;
+            }
+
+            // Text skips frames until its glyphs are in the atlas
+            if(Graphics::GlyphAtlas::GetInstance().GetPendingCount() == 0) {
+                textReadyTime = elapsed;
+                std::cout << "[Game] First complete frame after " << elapsed << " ms (glyph atlas cache " << (warm ? "warm" : "cold") << ")" << std::endl;
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(latencyMutex);
+
+        // The cursor was sampled during this frame
+        if(lowLatency && viewManager->HasLatched()) {
+            latchLatency.Add(std::chrono::duration<float, std::milli>(now - viewManager->GetLatchTime()).count());
+        }
+
+        if(input == 0) {
+            return;
+        }
+
+        auto elapsed = now.time_since_epoch() - std::chrono::steady_clock::duration(input);
+        inputLatency.Add(std::chrono::duration<float, std::milli>(elapsed).count());
+    }
+
+    float Game::GetInputLatency() const {
+        std::lock_guard<std::mutex> lock(latencyMutex);
+        return inputLatency.last;
+    }
+
+    float Game::GetAverageInputLatency() const {
+        std::lock_guard<std::mutex> lock(latencyMutex);
+        return inputLatency.GetAverage();
+    }
+
+    float Game::GetMaxInputLatency() const {
+        std::lock_guard<std::mutex> lock(latencyMutex);
+        return inputLatency.max;
+    }
+
+    float Game::GetAverageQueueLatency() const {
+        std::lock_guard<std::mutex> lock(latencyMutex);
+        return queueLatency.GetAverage();
+    }
+
+    float Game::GetAverageLatchLatency() const {
+        std::lock_guard<std::mutex> lock(latencyMutex);
+        return latchLatency.GetAverage();
+    }
+
     void Game::SetupEventHandlers() {
         SubscribeToEvent<InitEvent>(
             [this](const IEvent& /*event*/) {
@@ -6,6 +6,9 @@
 #include <memory>
 #include <atomic>
 #include <chrono>
+#include <mutex>
+#include <cstdint>
+#include <functional>
 
 namespace Engine {
     namespace Graphics {
@@ -56,12 +59,36 @@ namespace Engine {
         // Window Management
         std::shared_ptr<NativeWindow> GetMainWindow() { return mainWindow; }
 
+        // Rendering
+        std::shared_ptr<Graphics::IRenderingAPI> GetRenderingAPI() { return renderingAPI; }
+
         // Threading
         void RequestStop() { shouldStop = true; }
+        bool IsRenderThreadEnabled() const { return renderThreadEnabled; }
+        bool IsLowLatency() const { return lowLatency; }
+
+        // Input to present latency in milliseconds (oldest unpresented input event, from its OS timestamp)
+        float GetInputLatency() const;
+        float GetAverageInputLatency() const;
+        float GetMaxInputLatency() const;
+
+        // Parts of it: OS event to dispatch, and cursor latch to present (low-latency mode)
+        float GetAverageQueueLatency() const;
+        float GetAverageLatchLatency() const;
+
+        // Milliseconds from Initialize to the first presented frame, and to the first one with no text waiting for glyphs
+        float GetFirstFrameTime() const { return firstFrameTime; }
+        float GetTextReadyTime() const { return textReadyTime; }
 
 
     private:
         void SetupEventHandlers();
+        void RenderLoop();
+        void MarkInput();
+        void MarkPresented();
+
+        // Runs an input handler on the thread that owns the views (queued for the render thread when it is on)
+        void Forward(std::function<void()> handler);
 
         std::unique_ptr<ViewManager> viewManager;
         std::shared_ptr<NativeWindow> mainWindow;
@@ -70,5 +97,45 @@ namespace Engine {
         std::atomic<bool> shouldStop{false};
         std::atomic<bool> isShuttingDown{false};
         std::chrono::steady_clock::time_point shutdownStartTime;
+
+        // Dedicated render thread (owns the graphics context while running)
+        bool renderThreadEnabled = false;
+
+        // Event thread only: something was queued since the last input state update
+        bool inputForwarded = false;
+
+        // Late-latch the cursor and pace frames by deadline
+        bool lowLatency = false;
+
+        // Glyph atlas cache, only with a GPU backend
+        bool glyphCache = false;
+
+        // Time to first frame
+        std::chrono::high_resolution_clock::time_point startupBegin;
+        std::atomic<float> firstFrameTime{0.0f};
+        std::atomic<float> textReadyTime{0.0f};
+
+        // Input latency
+        struct LatencyStats {
+            float last      = 0.0f;
+            float max       = 0.0f;
+            double total    = 0.0;
+            uint64_t samples = 0;
+
+            void Add(float latency) {
+                last    = latency;
+                max     = latency > max ? latency : max;
+                total   += latency;
+                samples++;
+            }
+
+            float GetAverage() const { return samples > 0 ? static_cast<float>(total / samples) : 0.0f; }
+        };
+
+        std::atomic<int64_t> pendingInput{0};
+        mutable std::mutex latencyMutex;
+        LatencyStats inputLatency;
+        LatencyStats queueLatency;
+        LatencyStats latchLatency;
     };
 }
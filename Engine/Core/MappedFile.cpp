@@ -0,0 +1,103 @@
+#include "MappedFile.h"
+
+#ifdef _WIN32
+    #include <windows.h>
+#else
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+namespace Engine {
+    MappedFile::~MappedFile() {
+        Close();
+    }
+
+    bool MappedFile::Open(const std::string& path) {
+        Close();
+
+#ifdef _WIN32
+        HANDLE handle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+        if(handle == INVALID_HANDLE_VALUE) {
+            return false;
+        }
+
+        LARGE_INTEGER length;
+        HANDLE view = nullptr;
+
+        if(GetFileSizeEx(handle, &length) && length.QuadPart > 0) {
+            view = CreateFileMappingA(handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        }
+
+        void* address = view ? MapViewOfFile(view, FILE_MAP_READ, 0, 0, 0) : nullptr;
+
+        if(!address) {
+            if(view) {
+                CloseHandle(view);
+            }
+
+            CloseHandle(handle);
+            return false;
+        }
+
+        data    = static_cast<const unsigned char*>(address);
+        size    = static_cast<size_t>(length.QuadPart);
+        file    = handle;
+        mapping = view;
+        return true;
+#else
+        int descriptor = open(path.c_str(), O_RDONLY);
+
+        if(descriptor < 0) {
+            return false;
+        }
+
+        struct stat info;
+
+        if(fstat(descriptor, &info) != 0 || info.st_size <= 0) {
+            close(descriptor);
+            return false;
+        }
+
+        void* address = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+        close(descriptor);
+
+        if(address == MAP_FAILED) {
+            return false;
+        }
+
+        data    = static_cast<const unsigned char*>(address);
+        size    = static_cast<size_t>(info.st_size);
+        file    = nullptr;
+        mapping = address;
+        return true;
+#endif
+    }
+
+    void MappedFile::Close() {
+#ifdef _WIN32
+        if(data) {
+            UnmapViewOfFile(data);
+        }
+
+        if(mapping) {
+            CloseHandle(mapping);
+        }
+
+        if(file) {
+            CloseHandle(file);
+        }
+#else
+        if(data) {
+            munmap(const_cast<unsigned char*>(data), size);
+        }
+#endif
+
+        data    = nullptr;
+        size    = 0;
+        file    = nullptr;
+        mapping = nullptr;
+    }
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <string>
+#include <cstddef>
+
+namespace Engine {
+    /*
+     * Read-only memory mapping of a whole file. Pages are read by the OS on
+     * first access and shared with every other process mapping the file.
+     */
+    class MappedFile {
+        public:
+            MappedFile() = default;
+            ~MappedFile();
+
+            MappedFile(const MappedFile&) = delete;
+            MappedFile& operator=(const MappedFile&) = delete;
+
+            // False if the file can't be opened or is empty
+            bool Open(const std::string& path);
+            void Close();
+
+            bool IsOpen() const { return data != nullptr; }
+            const unsigned char* GetData() const { return data; }
+            size_t GetSize() const { return size; }
+
+        private:
+            const unsigned char* data   = nullptr;
+            size_t size                 = 0;
+            void* file                  = nullptr;
+            void* mapping               = nullptr;
+    };
+}
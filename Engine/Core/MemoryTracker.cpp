@@ -0,0 +1,368 @@
+#include "MemoryTracker.h"
+
+#ifdef ENGINE_MEMORY_TRACKING
+#include <iostream>
+#include <iomanip>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+
+#ifdef _WIN32
+    #include <windows.h>
+#endif
+#endif
+
+namespace Engine {
+    namespace {
+        const char* TAG_NAMES[] = { "other", "text", "rendering", "ui", "config", "events" };
+        const size_t TAG_COUNT  = static_cast<size_t>(MemoryTag::COUNT);
+
+        static_assert(sizeof(TAG_NAMES) / sizeof(TAG_NAMES[0]) == TAG_COUNT, "Every MemoryTag needs a name");
+    }
+
+    const char* GetMemoryTagName(MemoryTag tag) {
+        size_t index = static_cast<size_t>(tag);
+        return index < TAG_COUNT ? TAG_NAMES[index] : "unknown";
+    }
+
+    MemoryTracker& MemoryTracker::GetInstance() {
+        static MemoryTracker instance;
+        return instance;
+    }
+
+#ifdef ENGINE_MEMORY_TRACKING
+    namespace {
+        const int SITE_FRAMES = 4;
+
+        // Allocator for the bookkeeping itself, it must not come back into operator new
+        template<typename T>
+        struct Mallocator {
+            using value_type = T;
+
+            Mallocator() = default;
+            template<typename U> Mallocator(const Mallocator<U>&) {}
+
+            T* allocate(size_t count) {
+                void* memory = std::malloc(count * sizeof(T));
+
+                if(!memory) {
+                    throw std::bad_alloc();
+                }
+
+                return static_cast<T*>(memory);
+            }
+
+            void deallocate(T* pointer, size_t) { std::free(pointer); }
+
+            template<typename U> bool operator==(const Mallocator<U>&) const { return true; }
+            template<typename U> bool operator!=(const Mallocator<U>&) const { return false; }
+        };
+
+        struct Allocation {
+            size_t size;
+            uint32_t site;
+            MemoryTag tag;
+            void* frames[SITE_FRAMES];
+        };
+
+        using LiveMap = std::unordered_map<void*, Allocation, std::hash<void*>, std::equal_to<void*>, Mallocator<std::pair<void* const, Allocation>>>;
+
+        struct Counter {
+            std::atomic<uint64_t> allocations{0};
+            std::atomic<uint64_t> bytes{0};
+        };
+
+        struct State {
+            Counter total;
+            Counter tags[TAG_COUNT];
+            std::atomic<uint64_t> frees{0};
+            std::atomic<uint64_t> liveBytes{0};
+
+            std::mutex liveMutex;
+            LiveMap live;
+
+            std::mutex lastMutex;
+            MemoryFrame lastFrame;
+        };
+
+        thread_local MemoryTag currentTag   = MemoryTag::OTHER;
+        thread_local bool tracking          = false;
+
+        // Created on first use and never destroyed, deletes still arrive after static destruction
+        State& GetState() {
+            alignas(State) static unsigned char storage[sizeof(State)];
+            static State* state = new (storage) State();
+            return *state;
+        }
+
+        // Frames of the tracker itself that can sit above the allocating code, depending on inlining
+        const int TRACKER_FRAMES = 8;
+
+        // Caller is the return address operator new got, the site starts there
+        uint32_t CaptureSite(void* caller, void** frames) {
+            uint32_t hash = 2166136261u;
+            int count = 1;
+            frames[0] = caller;
+#ifdef _WIN32
+            // Counting our own frames breaks as soon as one is inlined, look for the caller instead
+            void* stack[TRACKER_FRAMES + SITE_FRAMES];
+            int captured = CaptureStackBackTrace(0, TRACKER_FRAMES + SITE_FRAMES, stack, nullptr);
+
+            for(int first = 0; first < captured; first++) {
+                if(stack[first] == caller) {
+                    count = std::min(SITE_FRAMES, captured - first);
+                    std::copy(stack + first, stack + first + count, frames);
+                    break;
+                }
+            }
+#endif
+            for(int index = 0; index < SITE_FRAMES; index++) {
+                if(index >= count) {
+                    frames[index] = nullptr;
+                    continue;
+                }
+
+                uintptr_t address = reinterpret_cast<uintptr_t>(frames[index]);
+
+                for(size_t byte = 0; byte < sizeof(address); byte++) {
+                    hash = (hash ^ ((address >> (byte * 8)) & 0xFF)) * 16777619u;
+                }
+            }
+
+            return hash;
+        }
+
+        void Track(void* pointer, size_t size, void* caller) {
+            if(!pointer || tracking) {
+                return;
+            }
+
+            tracking = true;
+            State& state = GetState();
+            size_t tag = static_cast<size_t>(currentTag);
+
+            state.total.allocations.fetch_add(1, std::memory_order_relaxed);
+            state.total.bytes.fetch_add(size, std::memory_order_relaxed);
+            state.tags[tag].allocations.fetch_add(1, std::memory_order_relaxed);
+            state.tags[tag].bytes.fetch_add(size, std::memory_order_relaxed);
+            state.liveBytes.fetch_add(size, std::memory_order_relaxed);
+
+            Allocation allocation;
+            allocation.size = size;
+            allocation.tag  = currentTag;
+            allocation.site = CaptureSite(caller, allocation.frames);
+
+            {
+                std::lock_guard<std::mutex> lock(state.liveMutex);
+                state.live[pointer] = allocation;
+            }
+
+            tracking = false;
+        }
+
+        void Untrack(void* pointer) {
+            if(!pointer || tracking) {
+                return;
+            }
+
+            tracking = true;
+            State& state = GetState();
+
+            {
+                std::lock_guard<std::mutex> lock(state.liveMutex);
+                auto it = state.live.find(pointer);
+
+                // Allocated before tracking started or by another module
+                if(it != state.live.end()) {
+                    state.liveBytes.fetch_sub(it->second.size, std::memory_order_relaxed);
+                    state.live.erase(it);
+                }
+            }
+
+            state.frees.fetch_add(1, std::memory_order_relaxed);
+            tracking = false;
+        }
+
+        void* Allocate(size_t size, void* caller) {
+            void* pointer = std::malloc(size ? size : 1);
+
+            while(!pointer) {
+                std::new_handler handler = std::get_new_handler();
+
+                if(!handler) {
+                    throw std::bad_alloc();
+                }
+
+                handler();
+                pointer = std::malloc(size ? size : 1);
+            }
+
+            Track(pointer, size, caller);
+            return pointer;
+        }
+
+        void Release(void* pointer) {
+            Untrack(pointer);
+            std::free(pointer);
+        }
+    }
+
+    MemoryScope::MemoryScope(MemoryTag tag) : previous(currentTag) {
+        currentTag = tag;
+    }
+
+    MemoryScope::~MemoryScope() {
+        currentTag = previous;
+    }
+
+    void MemoryTracker::EndFrame() {
+        State& state = GetState();
+        MemoryFrame frame;
+
+        frame.total.allocations = state.total.allocations.exchange(0);
+        frame.total.bytes       = state.total.bytes.exchange(0);
+
+        for(size_t tag = 0; tag < TAG_COUNT; tag++) {
+            frame.tags[tag].allocations = state.tags[tag].allocations.exchange(0);
+            frame.tags[tag].bytes       = state.tags[tag].bytes.exchange(0);
+        }
+
+        frame.frees     = state.frees.exchange(0);
+        frame.liveBytes = state.liveBytes.load();
+
+        {
+            std::lock_guard<std::mutex> lock(state.lastMutex);
+            state.lastFrame = frame;
+        }
+
+        uint64_t frameIndex = frames++;
+        bool over = (budgetAllocations > 0 && frame.total.allocations > budgetAllocations) ||
+                    (budgetBytes > 0 && frame.total.bytes > budgetBytes);
+
+        if(over) {
+            framesOverBudget++;
+            std::cout << "[Memory] Frame " << frameIndex << " over budget: " << frame.total.allocations
+                      << " allocations, " << frame.total.bytes << " bytes" << std::endl;
+        }
+    }
+
+    MemoryFrame MemoryTracker::GetLastFrame() const {
+        State& state = GetState();
+        std::lock_guard<std::mutex> lock(state.lastMutex);
+        return state.lastFrame;
+    }
+
+    size_t MemoryTracker::Report() const {
+        struct Site {
+            Allocation first;
+            uint64_t count;
+            uint64_t bytes;
+        };
+
+        State& state = GetState();
+        std::vector<Site, Mallocator<Site>> sites;
+        size_t total = 0;
+        uint64_t bytes = 0;
+
+        {
+            std::lock_guard<std::mutex> lock(state.liveMutex);
+            std::unordered_map<uint32_t, size_t, std::hash<uint32_t>, std::equal_to<uint32_t>, Mallocator<std::pair<const uint32_t, size_t>>> index;
+
+            for(const auto& [pointer, allocation] : state.live) {
+                (void) pointer;
+                auto it = index.find(allocation.site);
+
+                if(it == index.end()) {
+                    index[allocation.site] = sites.size();
+                    sites.push_back({ allocation, 1, allocation.size });
+                } else {
+                    sites[it->second].count++;
+                    sites[it->second].bytes += allocation.size;
+                }
+
+                total++;
+                bytes += allocation.size;
+            }
+        }
+
+        std::sort(sites.begin(), sites.end(), [](const Site& a, const Site& b) { return a.bytes > b.bytes; });
+
+        std::cout << "[Memory] " << total << " allocations (" << bytes / 1024 << " KB) still alive from "
+                  << sites.size() << " call sites, over budget in " << framesOverBudget.load() << " frames" << std::endl;
+
+        const size_t shown = std::min<size_t>(sites.size(), 20);
+
+        for(size_t index = 0; index < shown; index++) {
+            const Site& site = sites[index];
+
+            std::cout << "[Memory]   site " << std::hex << std::setw(8) << std::setfill('0') << site.first.site << std::dec << std::setfill(' ')
+                      << " " << GetMemoryTagName(site.first.tag) << ": " << site.count << " x, " << site.bytes << " bytes at";
+
+            for(void* frame : site.first.frames) {
+                if(frame) {
+                    std::cout << " " << frame;
+                }
+            }
+
+            std::cout << std::endl;
+        }
+
+        return total;
+    }
+#else
+    void MemoryTracker::EndFrame() {}
+
+    MemoryFrame MemoryTracker::GetLastFrame() const {
+        return MemoryFrame{};
+    }
+
+    size_t MemoryTracker::Report() const {
+        return 0;
+    }
+#endif
+}
+
+#ifdef ENGINE_MEMORY_TRACKING
+void* operator new(size_t size) {
+    return Engine::Allocate(size, __builtin_return_address(0));
+}
+
+void* operator new[](size_t size) {
+    return Engine::Allocate(size, __builtin_return_address(0));
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    try {
+        return Engine::Allocate(size, __builtin_return_address(0));
+    } catch(...) {
+        return nullptr;
+    }
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+    try {
+        return Engine::Allocate(size, __builtin_return_address(0));
+    } catch(...) {
+        return nullptr;
+    }
+}
+
+void operator delete(void* pointer) noexcept {
+    Engine::Release(pointer);
+}
+
+void operator delete[](void* pointer) noexcept {
+    Engine::Release(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept {
+    Engine::Release(pointer);
+}
+
+void operator delete[](void* pointer, size_t) noexcept {
+    Engine::Release(pointer);
+}
+#endif
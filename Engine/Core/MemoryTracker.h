@@ -0,0 +1,95 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace Engine {
+    // Subsystem an allocation is charged to, set with a MemoryScope
+    enum class MemoryTag : uint8_t {
+        OTHER       = 0,
+        TEXT        = 1,
+        RENDERING   = 2,
+        UI          = 3,
+        CONFIG      = 4,
+        EVENTS      = 5,
+        COUNT       = 6
+    };
+
+    const char* GetMemoryTagName(MemoryTag tag);
+
+    struct MemoryCounters {
+        uint64_t allocations    = 0;
+        uint64_t bytes          = 0;
+    };
+
+    // Heap use of one frame
+    struct MemoryFrame {
+        MemoryCounters total;
+        MemoryCounters tags[static_cast<size_t>(MemoryTag::COUNT)];
+        uint64_t frees          = 0;
+        uint64_t liveBytes      = 0;    // Still allocated when the frame ended
+    };
+
+    /*
+     * Opt-in heap instrumentation. Built with ENGINE_MEMORY_TRACKING the
+     * global operator new/delete count every allocation per frame and per
+     * tag, and remember live allocations by call-site hash for the leak
+     * report Engine::Shutdown prints. Without it every call is a no-op.
+     */
+    class MemoryTracker {
+        public:
+            static MemoryTracker& GetInstance();
+
+            static constexpr bool IsEnabled() {
+#ifdef ENGINE_MEMORY_TRACKING
+                return true;
+#else
+                return false;
+#endif
+            }
+
+            // Allocations / bytes allowed per frame, 0 disables the check
+            void SetFrameBudget(uint64_t allocations, uint64_t bytes = 0) {
+                budgetAllocations   = allocations;
+                budgetBytes         = bytes;
+            }
+
+            uint64_t GetFramesOverBudget() const { return framesOverBudget.load(); }
+
+            // Publishes the running counters as the last frame and checks the budget
+            void EndFrame();
+
+            MemoryFrame GetLastFrame() const;
+
+            // Prints allocations still alive grouped by call site, returns their count
+            size_t Report() const;
+
+        private:
+            MemoryTracker() = default;
+
+            std::atomic<uint64_t> budgetAllocations{0};
+            std::atomic<uint64_t> budgetBytes{0};
+            std::atomic<uint64_t> framesOverBudget{0};
+            std::atomic<uint64_t> frames{0};
+    };
+
+    // Charges allocations of the current thread to a tag until the scope ends
+    class MemoryScope {
+        public:
+#ifdef ENGINE_MEMORY_TRACKING
+            explicit MemoryScope(MemoryTag tag);
+            ~MemoryScope();
+#else
+            explicit MemoryScope(MemoryTag tag) { (void) tag; }
+#endif
+
+            MemoryScope(const MemoryScope&) = delete;
+            MemoryScope& operator=(const MemoryScope&) = delete;
+
+        private:
+#ifdef ENGINE_MEMORY_TRACKING
+            MemoryTag previous;
+#endif
+    };
+}
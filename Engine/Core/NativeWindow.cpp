@@ -311,6 +311,54 @@ namespace Engine {
 #endif
     }
 
+    void NativeWindow::ReleaseContext() {
+        if(!isCreated) {
+            return;
+        }
+
+#ifdef _WIN32
+        // A context can only be current on one thread at a time
+        wglMakeCurrent(nullptr, nullptr);
+#endif
+    }
+
+    bool NativeWindow::GetCursorPosition(float& x, float& y) const {
+        if(!isCreated) {
+            return false;
+        }
+
+#ifdef _WIN32
+        // Ask the OS directly instead of waiting for the next WM_MOUSEMOVE
+        POINT point;
+
+        if(!GetCursorPos(&point) || !ScreenToClient(hwnd, &point)) {
+            return false;
+        }
+
+        x = static_cast<float>(point.x);
+        y = static_cast<float>(point.y);
+        return true;
+#else
+        (void)x; (void)y;
+        return false;
+#endif
+    }
+
+    float NativeWindow::GetEventAge() const {
+#ifdef _WIN32
+        // Only meaningful inside a window callback (time of the message currently processed)
+        DWORD age = GetTickCount() - static_cast<DWORD>(GetMessageTime());
+
+        if(age > 1000) {
+            return 0.0f;
+        }
+
+        return static_cast<float>(age);
+#else
+        return 0.0f;
+#endif
+    }
+
     bool NativeWindow::CreatePlatformWindow() {
 #ifdef _WIN32
         // Register window class
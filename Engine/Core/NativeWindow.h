@@ -67,6 +67,10 @@ namespace Engine {
         void SetMouseMoveCallback(MouseMoveCallback callback) { mouseMoveCallback = callback; }
         void SetMouseScrollCallback(MouseScrollCallback callback) { mouseScrollCallback = callback; }
 
+        // Input sampling
+        bool GetCursorPosition(float& x, float& y) const;   // Newest cursor position in client coordinates
+        float GetEventAge() const;                          // Age of the message being dispatched (ms)
+
         // Platform-specific getters
 #ifdef _WIN32
         HWND GetHWND() const { return hwnd; }
@@ -76,6 +80,7 @@ namespace Engine {
         // Rendering context setup (for OpenGL/Vulkan/DirectX)
         bool SetupRenderingContext(const std::string& api);
         void MakeContextCurrent();
+        void ReleaseContext();
 
     private:
         WindowProperties properties;
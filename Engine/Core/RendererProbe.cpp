@@ -0,0 +1,240 @@
+#include "RendererProbe.h"
+#include "../Graphics/OpenGL/OpenGL.h"
+#include "../Graphics/Vulkan/Vulkan.h"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <memory>
+#include <cstdint>
+#include <cstring>
+
+#ifdef _WIN32
+    #include <windows.h>
+#endif
+
+namespace Engine {
+    namespace {
+        // Bump when the file layout changes
+        const int CACHE_FORMAT = 1;
+
+        std::vector<std::string> Split(const std::string& value, char delimiter) {
+            std::vector<std::string> parts;
+            std::stringstream stream(value);
+            std::string part;
+
+            while(std::getline(stream, part, delimiter)) {
+                parts.push_back(part);
+            }
+
+            // Keep trailing empty fields ("1|version|")
+            if(!value.empty() && value.back() == delimiter) {
+                parts.push_back("");
+            }
+
+            return parts;
+        }
+
+        std::string Sanitize(std::string value) {
+            for(char& c : value) {
+                if(c == '|' || c == ',' || c == '\n' || c == '\r') {
+                    c = ' ';
+                }
+            }
+
+            return value;
+        }
+    }
+
+    std::vector<ProbeResult> RendererProbe::Run() {
+        std::vector<ProbeResult> results;
+
+        for(const auto& [renderer, name] : EnumStringMap<Renderer>::values) {
+            std::unique_ptr<Graphics::IRenderingAPI> api;
+
+            switch(renderer) {
+                case Renderer::OPENGL:
+                    api = std::make_unique<Graphics::OpenGL::OpenGL>();
+                break;
+                case Renderer::VULKAN:
+                    api = std::make_unique<Graphics::Vulkan::Vulkan>();
+                break;
+                default:
+                    // DirectX backends don't exist yet
+                break;
+            }
+
+            if(!api) {
+                continue;
+            }
+
+            ProbeResult result;
+            result.renderer     = renderer;
+            result.available    = api->Available();
+
+            if(result.available) {
+                result.version  = api->GetVersion();
+                result.features = api->GetFeatures();
+            }
+
+            results.push_back(result);
+        }
+
+        return results;
+    }
+
+    std::string RendererProbe::GetFingerprint() {
+        std::string system = "format " + std::to_string(CACHE_FORMAT);
+
+#ifdef _WIN32
+        // GetVersionEx lies without a manifest, ntdll doesn't
+        typedef LONG (WINAPI* RtlGetVersionProc)(OSVERSIONINFOW*);
+        HMODULE ntdll = GetModuleHandleA("ntdll.dll");
+
+        if(ntdll) {
+            RtlGetVersionProc rtlGetVersion = reinterpret_cast<RtlGetVersionProc>(
+                reinterpret_cast<void*>(GetProcAddress(ntdll, "RtlGetVersion"))
+            );
+
+            OSVERSIONINFOW info = {};
+            info.dwOSVersionInfoSize = sizeof(info);
+
+            if(rtlGetVersion && rtlGetVersion(&info) == 0) {
+                system += "|windows " + std::to_string(info.dwMajorVersion) + "." + std::to_string(info.dwMinorVersion) + "." + std::to_string(info.dwBuildNumber);
+            }
+        }
+
+        DISPLAY_DEVICEA device = {};
+        device.cb = sizeof(device);
+
+        for(DWORD index = 0; EnumDisplayDevicesA(nullptr, index, &device, 0); index++) {
+            if(!(device.StateFlags & DISPLAY_DEVICE_PRIMARY_DEVICE)) {
+                device.cb = sizeof(device);
+                continue;
+            }
+
+            system += "|" + std::string(device.DeviceString) + "|" + std::string(device.DeviceID);
+
+            // DeviceKey is "\Registry\Machine\System\...\Video\{GUID}\0000"
+            const char* prefix = "\\Registry\\Machine\\";
+            std::string key = device.DeviceKey;
+
+            if(key.size() > std::strlen(prefix) && _strnicmp(key.c_str(), prefix, std::strlen(prefix)) == 0) {
+                char driver[128] = {};
+                DWORD size = sizeof(driver);
+
+                if(RegGetValueA(HKEY_LOCAL_MACHINE, key.c_str() + std::strlen(prefix), "DriverVersion", RRF_RT_REG_SZ, nullptr, driver, &size) == ERROR_SUCCESS) {
+                    system += "|driver " + std::string(driver);
+                }
+            }
+
+            break;
+        }
+#else
+        system += "|unknown";
+#endif
+
+        // FNV-1a, std::hash may change with the standard library and would drop every cache
+        uint64_t value = 14695981039346656037ull;
+
+        for(unsigned char byte : system) {
+            value = (value ^ byte) * 1099511628211ull;
+        }
+
+        std::stringstream hash;
+        hash << std::hex << value;
+        return hash.str();
+    }
+
+    bool RendererProbe::Load(const std::string& path, const std::string& fingerprint, std::vector<ProbeResult>& results) {
+        std::ifstream file(path);
+
+        if(!file) {
+            return false;
+        }
+
+        std::vector<ProbeResult> loaded;
+        std::string line;
+        bool matches = false;
+
+        while(std::getline(file, line)) {
+            if(line.empty() || line[0] == '#') {
+                continue;
+            }
+
+            size_t separator = line.find('=');
+
+            if(separator == std::string::npos) {
+                continue;
+            }
+
+            std::string key     = line.substr(0, separator);
+            std::string value   = line.substr(separator + 1);
+
+            if(key == "fingerprint") {
+                matches = (value == fingerprint);
+                continue;
+            }
+
+            // <Renderer>=<available>|<version>|<feature,feature,...>
+            std::vector<std::string> fields = Split(value, '|');
+
+            if(fields.size() != 3) {
+                return false;
+            }
+
+            bool known = false;
+
+            for(const auto& [renderer, name] : EnumStringMap<Renderer>::values) {
+                if(name == key) {
+                    ProbeResult result;
+                    result.renderer     = renderer;
+                    result.available    = (fields[0] == "1");
+                    result.version      = fields[1];
+
+                    if(!fields[2].empty()) {
+                        result.features = Split(fields[2], ',');
+                    }
+
+                    loaded.push_back(result);
+                    known = true;
+                    break;
+                }
+            }
+
+            if(!known) {
+                return false;
+            }
+        }
+
+        if(!matches || loaded.empty()) {
+            return false;
+        }
+
+        results = loaded;
+        return true;
+    }
+
+    bool RendererProbe::Save(const std::string& path, const std::string& fingerprint, const std::vector<ProbeResult>& results) {
+        std::ofstream file(path, std::ios::trunc);
+
+        if(!file) {
+            std::cout << "[RendererProbe] Can't write " << path << std::endl;
+            return false;
+        }
+
+        file << "# Renderer probe cache, deleted or outdated entries are probed again" << std::endl;
+        file << "fingerprint=" << fingerprint << std::endl;
+
+        for(const ProbeResult& result : results) {
+            file << ToString(result.renderer) << "=" << (result.available ? "1" : "0") << "|" << Sanitize(result.version) << "|";
+
+            for(size_t index = 0; index < result.features.size(); index++) {
+                file << (index > 0 ? "," : "") << Sanitize(result.features[index]);
+            }
+
+            file << std::endl;
+        }
+
+        return file.good();
+    }
+}
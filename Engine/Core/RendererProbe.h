@@ -0,0 +1,35 @@
+#pragma once
+#include "Enum/Renderer.h"
+#include <string>
+#include <vector>
+
+namespace Engine {
+    // Result of probing one rendering backend
+    struct ProbeResult {
+        Renderer renderer = Renderer::OPENGL;
+        bool available = false;
+        std::string version;
+        std::vector<std::string> features;
+
+        bool operator==(const ProbeResult& other) const {
+            return renderer == other.renderer && available == other.available && version == other.version && features == other.features;
+        }
+    };
+
+    /*
+     * Probing a renderer creates a throwaway window and context, which is slow.
+     * Results are cached on disk and only trusted while the fingerprint of the
+     * OS and display driver is unchanged.
+     */
+    class RendererProbe {
+        public:
+            // Creates each backend and asks it for availability, version and features
+            static std::vector<ProbeResult> Run();
+
+            // Hash of OS version, primary display adapter and its driver version
+            static std::string GetFingerprint();
+
+            static bool Load(const std::string& path, const std::string& fingerprint, std::vector<ProbeResult>& results);
+            static bool Save(const std::string& path, const std::string& fingerprint, const std::vector<ProbeResult>& results);
+    };
+}
@@ -1,4 +1,5 @@
 #include "Settings/Config.h"
+#include "../MemoryTracker.h"
 #include <filesystem>
 #include <fstream>
 #include <algorithm>
@@ -32,6 +33,8 @@ namespace Engine {
         }
 
         bool Config::LoadFromFile(const std::string& configPath) {
+            MemoryScope memoryScope(MemoryTag::CONFIG);
+
             std::string fullPath = ResolvePath(configPath);
             std::cout << "[Config] Attempting to load: " << fullPath << std::endl;
             std::ifstream file(fullPath);
@@ -6,7 +6,7 @@ namespace Engine {
     View::View(const std::string& name) :
         Renderable(name),
         isActive(false),
-        backgroundColor(new Graphics::RGBA(0.0f, 0.0f, 0.0f, 1.0f)) {
+        backgroundColor(0, 0, 0, 100) {
         /* Do Nothing */
     }
 
@@ -16,6 +16,7 @@ namespace Engine {
         }
 
         isActive = active;
+        RequestRedraw();
 
         if(active) {
             SetVisible(true);
@@ -28,12 +29,18 @@ namespace Engine {
         }
     }
 
-    void View::SetBackground(Graphics::IColor* color) {
+    void View::SetBackground(Graphics::Color color) {
         backgroundColor = color;
+        InvalidateLayers();
+        RequestRedraw();
     }
 
     void View::SetBackgroundImage(const std::string& file) {
-        backgroundImage = file;
+        if(backgroundImage != file) {
+            backgroundImage = file;
+            InvalidateLayers();
+            RequestRedraw();
+        }
     }
 
     void View::SetWindowDimensions(int width, int height) {
@@ -45,6 +52,8 @@ namespace Engine {
 
             // Update viewport manager with new window dimensions
             viewportManager.SetWindowDimensions(width, height);
+            InvalidateLayers();
+            RequestRedraw();
 
             OnResize(width, height, oldWidth, oldHeight);
         }
@@ -55,6 +64,58 @@ namespace Engine {
         renderingAPI.SetViewport(viewport.x, viewport.y, viewport.width, viewport.height);
     }
 
+    void View::RenderLayer(Graphics::IRenderingAPI& renderingAPI, const std::string& name, const std::function<void(Graphics::IRenderingAPI&)>& paint) {
+        auto it = layers.find(name);
+
+        if(it == layers.end()) {
+            it = layers.emplace(name, std::make_unique<Graphics::Layer>(name)).first;
+        }
+
+        it->second->Render(renderingAPI, renderingAPI.GetWidth(), renderingAPI.GetHeight(), paint);
+    }
+
+    void View::InvalidateLayer(const std::string& name) {
+        auto it = layers.find(name);
+
+        if(it != layers.end()) {
+            it->second->Invalidate();
+        }
+    }
+
+    void View::InvalidateLayers() {
+        for(auto& layer : layers) {
+            layer.second->Invalidate();
+        }
+    }
+
+    void View::CollectDamage(Graphics::DamageRegion& damage) {
+        bool full = !damageTracking || redrawRequested;
+
+        // A dirty layer repaints the whole surface anyway
+        for(auto& layer : layers) {
+            if(layer.second->IsDirty()) {
+                full = true;
+            }
+        }
+
+        redrawRequested = false;
+
+        if(full) {
+            damage.MarkFull();
+            return;
+        }
+
+        OnCollectDamage(damage);
+    }
+
+    void View::LatchInput(float x, float y) {
+        if(!isActive) {
+            return;
+        }
+
+        OnLatchInput(x, y);
+    }
+
 
     void View::OnKey(Input::KEY key, std::function<void()> callback) {
         OnKey(key, Input::KeyAction::PRESS, callback);
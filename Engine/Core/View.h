@@ -4,12 +4,15 @@
 #include "Event.h"
 #include "ViewportManager.h"
 #include "Input/InputManager.h"
-#include "../Graphics/IColor.h"
+#include "../Graphics/Color.h"
 #include "../Graphics/RGB.h"
 #include "../Graphics/RGBA.h"
 #include "../Graphics/HEX.h"
+#include "../Graphics/Layer.h"
+#include "../Graphics/DamageRegion.h"
 #include <memory>
 #include <algorithm>
+#include <unordered_map>
 
 // Forward declarations
 namespace Engine {
@@ -33,8 +36,8 @@ namespace Engine {
         void SetActive(bool active);
 
         // Background color
-        void SetBackground(Graphics::IColor* color);
-        Graphics::IColor* GetBackground() { return backgroundColor; }
+        void SetBackground(Graphics::Color color);
+        Graphics::Color GetBackground() { return backgroundColor; }
 
         // Background Image
         void SetBackgroundImage(const std::string& name);
@@ -80,6 +83,20 @@ namespace Engine {
         // Apply viewport to rendering API
         void ApplyViewport(Graphics::IRenderingAPI& renderingAPI);
 
+        // Cached layers (re-painted on resize, background change or invalidation)
+        void RenderLayer(Graphics::IRenderingAPI& renderingAPI, const std::string& name, const std::function<void(Graphics::IRenderingAPI&)>& paint);
+        void InvalidateLayer(const std::string& name);
+        void InvalidateLayers();
+
+        // Damage tracking: opted-in views report changed regions, all others repaint fully
+        void SetDamageTracking(bool enabled) { damageTracking = enabled; }
+        bool IsDamageTracking() const { return damageTracking; }
+        void RequestRedraw() { redrawRequested = true; }
+        void CollectDamage(Graphics::DamageRegion& damage);
+
+        // Late-latched input: newest cursor position, sampled right before rendering
+        void LatchInput(float x, float y);
+
         // Input handling
         void OnKey(Input::KEY key, std::function<void()> callback);
         void OnKey(Input::KEY key, Input::KeyAction action, std::function<void()> callback);
@@ -113,7 +130,7 @@ namespace Engine {
 
     protected:
         bool isActive;
-        Graphics::IColor* backgroundColor;
+        Graphics::Color backgroundColor;
         std::string backgroundImage;
         int windowWidth = 800;
         int windowHeight = 600;
@@ -121,6 +138,9 @@ namespace Engine {
         // Viewport and scaling system
         ViewportManager viewportManager;
 
+        // Cached layers by name
+        std::unordered_map<std::string, std::unique_ptr<Graphics::Layer>> layers;
+
         // Input key bindings (stored per view instance)
         std::vector<std::pair<Input::KEY, Input::KeyAction>> activeKeyBindings;
         
@@ -130,6 +150,16 @@ namespace Engine {
         // ViewManager reference
         ViewManager* viewManager = nullptr;
 
+        // Damage tracking
+        bool damageTracking = false;
+        bool redrawRequested = true;
+
+        // Report changed regions (only called for views with damage tracking)
+        virtual void OnCollectDamage(Graphics::DamageRegion& /*damage*/) {}
+
+        // Update cursor-dependent state (hover) from the latched position
+        virtual void OnLatchInput(float /*x*/, float /*y*/) {}
+
         // Helper for subclasses
         virtual void UpdateInternal(float /*deltaTime*/) {}
         virtual void RenderInternal() {}
@@ -2,6 +2,11 @@
 #include "Engine.h"
 #include "../Graphics/OpenGL/OpenGL.h"
 #include "../Graphics/IRenderingAPI.h"
+#include "../Graphics/RenderStats.h"
+#include "FrameArena.h"
+#include "MemoryTracker.h"
+#include "../Graphics/UI/Text/Text.h"
+#include "../Graphics/UI/Text/TextSpriteCache.h"
 #include "../../Game/UI/Views/Overlay.h"
 #include <iostream>
 #include <algorithm>
@@ -11,6 +16,8 @@ namespace Engine {
         /* Do Nothing */
     }
 
+    ViewManager::~ViewManager() = default;
+
     void ViewManager::RegisterView(const std::string& name, ViewPtr view) {
         if(!view) {
             //std::cout << "[ViewManager] Warning: Attempted to register null view" << std::endl;
@@ -127,6 +134,7 @@ namespace Engine {
 
         // Start transition
         isTransitioning = true;
+        fullRedraw = true;
         transitionProgress = 0.0f;
         currentTransition = transition;
         transitionSourceView = currentView;
@@ -196,16 +204,51 @@ namespace Engine {
         renderingAPI = api;
     }
 
-    void ViewManager::RenderViews(Graphics::IRenderingAPI& api) {
+    bool ViewManager::RenderViews(Graphics::IRenderingAPI& api) {
+        MemoryScope memoryScope(MemoryTag::RENDERING);
+
         if(!renderWindow || !renderWindow->IsValid()) {
-            return;
+            return false;
         }
 
         // Make the window's rendering context current
         renderWindow->MakeContextCurrent();
 
+        // Resizes from the event thread are applied here, nothing below sees a half resized state
+        ApplyResize();
+
+        // Key and mouse handlers change views, overlays and text, so they run here and not on the event thread
+        RunPosted();
+
+        // Glyphs rasterized by the workers since the last frame go into the atlas
+        Graphics::GlyphAtlas::BeginFrame();
+
         // Views are updated via resize callback, no need to update every frame
 
+        // Hover changes from the latched cursor have to be part of this frame's damage
+        latched = lowLatency && LatchInput();
+
+        CollectDamage(api);
+
+        // Nothing changed: the last presented frame is still valid (unless it is being captured)
+        if(frameDamage.IsEmpty() && !debugDamage && !statsOverlay && !capture.IsBusy()) {
+            // The allocation budget is per render pass, skipped frames don't pile onto the next one
+            MemoryTracker::GetInstance().EndFrame();
+            return false;
+        }
+
+        const auto& frameProps = renderWindow->GetProperties();
+        bool offscreen = frameTarget.IsValid();
+
+        if(offscreen) {
+            api.BindRenderTarget(&frameTarget);
+        }
+
+        if(!frameDamage.IsFull() && !frameDamage.IsEmpty()) {
+            Graphics::Rect clip = frameDamage.GetBounds();
+            api.SetScissor(&clip);
+        }
+
         // Render the appropriate view(s)
         if(isTransitioning) {
             // std::cout << "[ViewManager] Rendering transition - progress: " << transitionProgress << std::endl;
@@ -234,7 +277,7 @@ namespace Engine {
                 const auto& props = renderWindow->GetProperties();
                 // std::cout << "[ViewManager] Window properties: " << props.width << "x" << props.height << std::endl;
                 api.Begin2D(props.width, props.height);
-                api.DrawRect(0, 0, props.width, props.height, new ::Engine::Graphics::RGBA(0.0f, 0.0f, 0.0f, overlayAlpha));
+                api.DrawRect(0, 0, props.width, props.height, ::Engine::Graphics::Color::FromFloats(0.0f, 0.0f, 0.0f, overlayAlpha));
                 api.End2D();
             } else {
                 // Second half: fade in new view
@@ -257,7 +300,7 @@ namespace Engine {
                 const auto& props = renderWindow->GetProperties();
                 // std::cout << "[ViewManager] Window properties: " << props.width << "x" << props.height << std::endl;
                 api.Begin2D(props.width, props.height);
-                api.DrawRect(0, 0, props.width, props.height, new ::Engine::Graphics::RGBA(0.0f, 0.0f, 0.0f, overlayAlpha));
+                api.DrawRect(0, 0, props.width, props.height, ::Engine::Graphics::Color::FromFloats(0.0f, 0.0f, 0.0f, overlayAlpha));
                 api.End2D();
             }
         } else {
@@ -277,14 +320,217 @@ namespace Engine {
             }
         }
 
+        api.SetScissor(nullptr);
+
+        // Copy the preserved frame to the back buffer
+        if(offscreen) {
+            api.BindRenderTarget(nullptr);
+            api.Begin2D(frameProps.width, frameProps.height);
+            api.DrawRenderTarget(frameTarget, 0.0f, 0.0f, static_cast<float>(frameProps.width), static_cast<float>(frameProps.height));
+            api.End2D();
+        }
+
+        // Debug drawing doesn't count as frame work
+        Graphics::RenderStats& stats = Graphics::RenderStats::GetInstance();
+        stats.SetEnabled(false);
+
+        if(debugDamage) {
+            RenderDamageDebug(api);
+        }
+
+        if(statsOverlay) {
+            RenderStatsOverlay(api);
+        }
+
+        stats.SetEnabled(true);
+
+        // Screenshots / recording read back the finished back buffer
+        capture.OnFrame(api);
+
         // Present the frame
         api.SwapBuffers();
+
+        // Transient frame data is gone from here on, the arenas report their use to the stats
+        FrameArena::EndFrame();
+        Graphics::GlyphAtlas::EndFrame();
+        Graphics::TextSpriteCache::EndFrame(api);
+        stats.EndFrame();
+        MemoryTracker::GetInstance().EndFrame();
+
+        return true;
+    }
+
+    bool ViewManager::LatchInput() {
+        float x = 0.0f;
+        float y = 0.0f;
+
+        if(!renderWindow->GetCursorPosition(x, y)) {
+            return false;
+        }
+
+        latchTime = std::chrono::steady_clock::now();
+
+        for(auto& [name, view] : views) {
+            if(view && view->IsActive() && view->IsVisible()) {
+                view->LatchInput(x, y);
+            }
+        }
+
+        for(auto& [name, overlay] : overlays) {
+            if(overlay && overlay->IsActive() && overlay->IsVisible()) {
+                overlay->LatchInput(x, y);
+            }
+        }
+
+        return true;
+    }
+
+    void ViewManager::CollectDamage(Graphics::IRenderingAPI& api) {
+        const auto& props = renderWindow->GetProperties();
+
+        // Partial redraws need the previous frame, so keep it in an offscreen target
+        if(!frameTarget.IsValid() || frameTarget.width != props.width || frameTarget.height != props.height) {
+            api.DestroyRenderTarget(frameTarget);
+            frameTarget = api.CreateRenderTarget(props.width, props.height);
+            fullRedraw = true;
+        }
+
+        frameDamage.Clear();
+
+        for(auto& [name, view] : views) {
+            if(view && view->IsActive() && view->IsVisible()) {
+                view->CollectDamage(frameDamage);
+            }
+        }
+
+        for(auto& [name, overlay] : overlays) {
+            if(overlay && overlay->IsActive() && overlay->IsVisible()) {
+                overlay->CollectDamage(frameDamage);
+            }
+        }
+
+        if(fullRedraw || isTransitioning || !frameTarget.IsValid()) {
+            frameDamage.MarkFull();
+        }
+
+        // Keep the frame after a transition full as well
+        fullRedraw = isTransitioning;
+
+        if(frameDamage.IsFull()) {
+            return;
+        }
+
+        // Damage outside the window is irrelevant
+        Graphics::Rect window(0.0f, 0.0f, static_cast<float>(props.width), static_cast<float>(props.height));
+
+        if(!frameDamage.GetBounds().Intersects(window)) {
+            frameDamage.Clear();
+        }
+    }
+
+    void ViewManager::RenderDamageDebug(Graphics::IRenderingAPI& api) {
+        const Graphics::Color fill(255, 0, 0, 20);
+        const Graphics::Color outline(255, 0, 0, 80);
+        const Graphics::Color full(255, 255, 0, 80);
+
+        const auto& props = renderWindow->GetProperties();
+        float w = static_cast<float>(props.width);
+        float h = static_cast<float>(props.height);
+
+        api.Begin2D(props.width, props.height);
+
+        if(frameDamage.IsFull()) {
+            // Full repaint: yellow frame around the window
+            api.DrawRect(0.0f, 0.0f, w, 2.0f, full);
+            api.DrawRect(0.0f, h - 2.0f, w, 2.0f, full);
+            api.DrawRect(0.0f, 0.0f, 2.0f, h, full);
+            api.DrawRect(w - 2.0f, 0.0f, 2.0f, h, full);
+        } else {
+            for(const Graphics::Rect& rect : frameDamage.GetRects()) {
+                api.DrawRect(rect.x, rect.y, rect.width, rect.height, fill);
+                api.DrawRect(rect.x, rect.y, rect.width, 1.0f, outline);
+                api.DrawRect(rect.x, rect.GetBottom() - 1.0f, rect.width, 1.0f, outline);
+                api.DrawRect(rect.x, rect.y, 1.0f, rect.height, outline);
+                api.DrawRect(rect.GetRight() - 1.0f, rect.y, 1.0f, rect.height, outline);
+            }
+        }
+
+        api.End2D();
+    }
+
+    void ViewManager::SetStatsOverlay(bool enabled, const std::string& font) {
+        statsOverlay = enabled;
+
+        if(!font.empty() && font != statsFont) {
+            statsFont = font;
+            statsLines.clear();
+        }
+
+        fullRedraw = true;
+    }
+
+    void ViewManager::RenderStatsOverlay(Graphics::IRenderingAPI& api) {
+        const Graphics::Color background(0, 0, 0, 60);
+        const Graphics::Color foreground(255, 255, 255, 100);
+
+        const Graphics::FrameStats frame = Graphics::RenderStats::GetInstance().GetLastFrame();
+        const MemoryFrame memory = MemoryTracker::GetInstance().GetLastFrame();
+        const Graphics::FontStats fonts = Graphics::FontManager::GetInstance().GetStats();
+        const Graphics::GlyphAtlas& atlas = Graphics::GlyphAtlas::GetInstance();
+        const Graphics::TextSpriteCache& sprites = Graphics::TextSpriteCache::GetInstance();
+
+        const std::string lines[] = {
+            "Draw calls: "      + std::to_string(frame.drawCalls),
+            "Vertices: "        + std::to_string(frame.vertices),
+            "Texture binds: "   + std::to_string(frame.textureBinds),
+            "State changes: "   + std::to_string(frame.stateChanges),
+            "Glyphs: "          + std::to_string(frame.glyphs),
+            "Layouts: "         + std::to_string(frame.layouts) + " built in " + std::to_string(frame.layoutTime) + " us, " + std::to_string(frame.layoutHits) + " cached",
+            "Text effects: "    + std::to_string(frame.effectGlyphs) + " glyphs in " + std::to_string(frame.effectTime / 1000) + " us" + (frame.effectTime > 0 ? ", " + std::to_string(frame.effectGlyphs * 1000 / frame.effectTime) + "M glyphs/s" : std::string()),
+            "Uploaded: "        + std::to_string(frame.bytesUploaded / 1024) + " KB",
+            "Queued quads: "    + std::to_string(frame.queuedQuads),
+            "Queue runs: "      + std::to_string(frame.queueRuns) + " / " + std::to_string(frame.unsortedRuns) + " unsorted",
+            "Culled quads: "    + std::to_string(frame.culledQuads),
+            "Frame arena: "     + std::to_string(frame.arenaBytes / 1024) + " KB, peak " + std::to_string(frame.arenaHighWater / 1024) + " KB",
+            "Heap: "            + (MemoryTracker::IsEnabled() ? std::to_string(memory.total.allocations) + " allocs, " + std::to_string(memory.total.bytes / 1024) + " KB" : std::string("not tracked")),
+            "Fonts: "           + std::to_string(fonts.files) + " files (" + std::to_string(fonts.mappedBytes / 1024) + " KB), " + std::to_string(fonts.glyphSets) + " sizes, " + std::to_string(fonts.loads) + " loads",
+            "Glyph atlas: "     + std::to_string(atlas.GetPageCount()) + "/" + std::to_string(atlas.GetBudget() / Graphics::GlyphAtlas::PAGE_BYTES) + " pages, " + std::to_string(atlas.GetGlyphCount()) + " glyphs",
+            "Glyph work: "      + std::to_string(atlas.GetPendingCount()) + " pending, " + std::to_string(atlas.GetEvictions()) + " pages evicted",
+            "Text sprites: "    + std::to_string(sprites.GetCount()) + ", " + std::to_string(sprites.GetBytes() / 1024) + "/" + std::to_string(sprites.GetBudget() / 1024) + " KB, " + std::to_string(sprites.GetEvictions()) + " evicted"
+        };
+
+        const size_t count      = sizeof(lines) / sizeof(lines[0]);
+        const float lineHeight  = 18.0f;
+
+        if(statsLines.size() != count) {
+            statsLines.clear();
+
+            for(size_t index = 0; index < count; index++) {
+                auto text = std::make_unique<Graphics::Text>();
+                text->SetSize(14.0f);
+                text->SetFont(statsFont);
+                text->SetColor(foreground);
+                statsLines.push_back(std::move(text));
+            }
+        }
+
+        const auto& props = renderWindow->GetProperties();
+        api.Begin2D(props.width, props.height);
+        api.DrawRect(8.0f, 8.0f, 320.0f, count * lineHeight + 8.0f, background);
+
+        for(size_t index = 0; index < count; index++) {
+            statsLines[index]->SetValue(lines[index]);
+            statsLines[index]->Render(api, 14.0f, 12.0f + index * lineHeight);
+        }
+
+        api.End2D();
     }
 
     void ViewManager::ShowOverlay(const std::string& name, ViewPtr overlay) {
         if(overlay) {
             overlays[name] = overlay;
             overlay->SetActive(true);
+            fullRedraw = true;
             overlay->SetViewManager(this);
 
             // Set window dimensions if available
@@ -301,6 +547,7 @@ namespace Engine {
             it->second->SetActive(false);
             // DON'T clear key bindings - let the isActive check handle it
             overlays.erase(it);
+            fullRedraw = true;
         }
     }
 
@@ -312,6 +559,7 @@ namespace Engine {
             }
         }
         overlays.clear();
+        fullRedraw = true;
     }
 
     bool ViewManager::HasActiveOverlay() const {
@@ -328,6 +576,8 @@ namespace Engine {
             renderingAPI->SetViewport(width, height);
         }
 
+        fullRedraw = true;
+
         // Update the NativeWindow properties so context.GetWidth/Height() returns correct values
         if(renderWindow) {
             renderWindow->UpdateWindowProperties(width, height);
@@ -347,6 +597,43 @@ namespace Engine {
         }
     }
 
+    void ViewManager::RequestResize(int width, int height) {
+        if(width <= 0 || height <= 0) {
+            return;
+        }
+
+        pendingResize = (static_cast<uint64_t>(width) << 32) | static_cast<uint32_t>(height);
+    }
+
+    void ViewManager::ApplyResize() {
+        uint64_t size = pendingResize.exchange(0);
+
+        if(size == 0) {
+            return;
+        }
+
+        UpdateViewDimensions(static_cast<int>(size >> 32), static_cast<int>(size & 0xFFFFFFFF));
+    }
+
+    void ViewManager::Post(std::function<void()> task) {
+        std::lock_guard<std::mutex> lock(postedMutex);
+        posted.push_back(std::move(task));
+    }
+
+    void ViewManager::RunPosted() {
+        std::vector<std::function<void()>> tasks;
+
+        {
+            std::lock_guard<std::mutex> lock(postedMutex);
+            tasks.swap(posted);
+        }
+
+        // Outside the lock, a handler may post again (it runs next frame)
+        for(auto& task : tasks) {
+            task();
+        }
+    }
+
     Engine& ViewManager::GetEngine() const {
         return Engine::GetInstance();
     }
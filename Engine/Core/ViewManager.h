@@ -4,8 +4,17 @@
 #include "View.h"
 #include "Event.h"
 #include "NativeWindow.h"
+#include "../Graphics/RenderTarget.h"
+#include "../Graphics/DamageRegion.h"
+#include "../Graphics/FrameCapture.h"
 #include <unordered_map>
 #include <memory>
+#include <vector>
+#include <chrono>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
 
 // Forward declarations
 namespace Engine {
@@ -19,12 +28,13 @@ class Overlay;
 namespace Engine {
     namespace Graphics {
         class IRenderingAPI;
+        class Text;
     }
 
     class ViewManager {
     public:
         ViewManager(Game* game = nullptr);
-        ~ViewManager() = default;
+        ~ViewManager();
 
         // View registration and management
         void RegisterView(const std::string& name, ViewPtr view);
@@ -51,15 +61,42 @@ namespace Engine {
         void UpdateViews(float deltaTime);
 
         // Rendering
-        void RenderViews(Graphics::IRenderingAPI& renderingAPI);
+        // Returns true if a frame was presented
+        bool RenderViews(Graphics::IRenderingAPI& renderingAPI);
         void SetRenderTarget(std::shared_ptr<NativeWindow> window);
         void SetRenderingAPI(std::shared_ptr<Graphics::IRenderingAPI> api);
 
+        // Partial redraw: only the damaged area of the preserved frame is repainted
+        void RequestFullRedraw() { fullRedraw = true; }
+        void SetDebugDamage(bool enabled) { debugDamage = enabled; }
+        bool IsDebugDamage() const { return debugDamage; }
+        const Graphics::DamageRegion& GetLastDamage() const { return frameDamage; }
+
+        // Render statistics HUD (counters of the last presented frame)
+        void SetStatsOverlay(bool enabled, const std::string& font = "");
+        bool IsStatsOverlay() const { return statsOverlay; }
+
+        // Low-latency mode: the newest cursor position is latched right before rendering
+        void SetLowLatency(bool enabled) { lowLatency = enabled; }
+        bool IsLowLatency() const { return lowLatency; }
+        std::chrono::steady_clock::time_point GetLatchTime() const { return latchTime; }
+        // False if the cursor couldn't be read in the last rendered frame (latch time is stale)
+        bool HasLatched() const { return latched; }
+
+        // Screenshots and frame recording
+        Graphics::FrameCapture& GetFrameCapture() { return capture; }
+
         // Event handling
         void OnViewChangeEvent(const ViewChangeEvent& event);
         
         // Window dimension updates
         void UpdateViewDimensions(int width, int height);
+
+        // Any thread: the new size is applied by the next RenderViews, on the thread owning the context
+        void RequestResize(int width, int height);
+
+        // Any thread: runs the task at the start of the next RenderViews, before the frame is built (in posting order)
+        void Post(std::function<void()> task);
         
         // Engine access
         Engine& GetEngine() const;
@@ -86,6 +123,39 @@ namespace Engine {
         // Game instance
         Game* gameInstance = nullptr;
 
+        // Preserved frame and damage of the current frame
+        Graphics::RenderTarget frameTarget;
+        Graphics::DamageRegion frameDamage;
+        bool fullRedraw = true;
+        bool debugDamage = false;
+
+        Graphics::FrameCapture capture;
+
+        bool statsOverlay = false;
+        std::string statsFont;
+        std::vector<std::unique_ptr<Graphics::Text>> statsLines;
+
+        bool lowLatency = false;
+        std::chrono::steady_clock::time_point latchTime;
+        bool latched = false;
+
+        // Window size waiting for the render thread, width << 32 | height (0 = none)
+        std::atomic<uint64_t> pendingResize{0};
+
+        void ApplyResize();
+
+        // Input handlers forwarded by the event thread while rendering runs on its own thread
+        std::mutex postedMutex;
+        std::vector<std::function<void()>> posted;
+
+        void RunPosted();
+
+        // Returns false if the cursor position couldn't be read
+        bool LatchInput();
+        void CollectDamage(Graphics::IRenderingAPI& api);
+        void RenderDamageDebug(Graphics::IRenderingAPI& api);
+        void RenderStatsOverlay(Graphics::IRenderingAPI& api);
+
         void TransitionTo(const std::string& newView, Transition transition = Transition::FADE);
         void UpdateTransition(float deltaTime);
     };
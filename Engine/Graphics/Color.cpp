@@ -0,0 +1,40 @@
+#include "Color.h"
+#include "HEX.h"
+#include <algorithm>
+
+namespace Engine {
+    namespace Graphics {
+        namespace {
+            uint32_t ToByte(float value) {
+                return static_cast<uint32_t>(std::max(0.0f, std::min(value, 1.0f)) * 255.0f + 0.5f);
+            }
+        }
+
+        Color Color::FromFloats(float red, float green, float blue, float alpha) {
+            return FromPacked(ToByte(red) | ToByte(green) << 8 | ToByte(blue) << 16 | ToByte(alpha) << 24);
+        }
+
+        Color Color::FromHex(const std::string& value) {
+            return Color(HEX(value));
+        }
+
+        Color Color::WithAlpha(float alpha) const {
+            return FromPacked((packed & 0x00FFFFFF) | ToByte(alpha) << 24);
+        }
+
+        Color Color::MultiplyAlpha(float factor) const {
+            return WithAlpha(GetAlpha() * factor);
+        }
+
+        Color Color::Mix(Color from, Color to, float t) {
+            t = std::max(0.0f, std::min(t, 1.0f));
+
+            return FromFloats(
+                from.GetRed() + (to.GetRed() - from.GetRed()) * t,
+                from.GetGreen() + (to.GetGreen() - from.GetGreen()) * t,
+                from.GetBlue() + (to.GetBlue() - from.GetBlue()) * t,
+                from.GetAlpha() + (to.GetAlpha() - from.GetAlpha()) * t
+            );
+        }
+    }
+}
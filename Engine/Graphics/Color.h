@@ -0,0 +1,76 @@
+#pragma once
+#include "IColor.h"
+#include <string>
+#include <cstdint>
+#include <type_traits>
+
+namespace Engine {
+    namespace Graphics {
+        // Float view of a Color, 0..1 per channel
+        struct Float4 {
+            float r;
+            float g;
+            float b;
+            float a;
+        };
+
+        /*
+         * Packed RGBA8 color passed by value through the rendering API and
+         * widgets. Red is the lowest byte, so the value matches GL_RGBA /
+         * GL_UNSIGNED_BYTE pixels. IColor implementations (RGBA, HEX, RGB)
+         * convert implicitly and are only kept as adapters.
+         */
+        class Color {
+            public:
+                // Transparent black
+                constexpr Color() : packed(0) {}
+
+                // Channels 0..255, alpha in percent like RGBA
+                constexpr Color(int red, int green, int blue, int alpha = 100)
+                    : packed(static_cast<uint32_t>(Byte(red)) |
+                             static_cast<uint32_t>(Byte(green)) << 8 |
+                             static_cast<uint32_t>(Byte(blue)) << 16 |
+                             static_cast<uint32_t>(Byte((Clamp(alpha, 100) * 255 + 50) / 100)) << 24) {}
+
+                Color(const IColor& color) : packed(FromFloats(color.GetRed(), color.GetGreen(), color.GetBlue(), color.GetAlpha()).packed) {}
+                Color(const IColor* color) : packed(color ? Color(*color).packed : 0) {}
+
+                static constexpr Color FromPacked(uint32_t value) { return Color(value, 0); }
+                static Color FromFloats(float red, float green, float blue, float alpha = 1.0f);
+                static Color FromHex(const std::string& value);
+
+                float GetRed() const { return (packed & 0xFF) / 255.0f; }
+                float GetGreen() const { return ((packed >> 8) & 0xFF) / 255.0f; }
+                float GetBlue() const { return ((packed >> 16) & 0xFF) / 255.0f; }
+                float GetAlpha() const { return (packed >> 24) / 255.0f; }
+
+                uint32_t GetPacked() const { return packed; }
+                Float4 ToFloat4() const { return { GetRed(), GetGreen(), GetBlue(), GetAlpha() }; }
+
+                Color WithAlpha(float alpha) const;
+                Color MultiplyAlpha(float factor) const;
+
+                // Linear blend, t = 0 is from, t = 1 is to
+                static Color Mix(Color from, Color to, float t);
+
+                bool operator==(const Color& other) const { return packed == other.packed; }
+                bool operator!=(const Color& other) const { return packed != other.packed; }
+
+            private:
+                constexpr Color(uint32_t value, int) : packed(value) {}
+
+                static constexpr int Clamp(int value, int maximum) {
+                    return value < 0 ? 0 : (value > maximum ? maximum : value);
+                }
+
+                static constexpr uint8_t Byte(int value) {
+                    return static_cast<uint8_t>(Clamp(value, 255));
+                }
+
+                uint32_t packed;
+        };
+
+        static_assert(std::is_trivially_copyable<Color>::value, "Color is passed by value");
+        static_assert(sizeof(Color) == 4, "Color is packed RGBA8");
+    }
+}
@@ -0,0 +1,66 @@
+#include "DamageRegion.h"
+
+namespace Engine {
+    namespace Graphics {
+        void DamageRegion::Add(const Rect& rect) {
+            if(rect.IsEmpty()) {
+                return;
+            }
+
+            // Merge into an existing rect when they overlap, keeps the list short
+            for(Rect& existing : rects) {
+                if(existing.Intersects(rect)) {
+                    existing = existing.Union(rect);
+                    bounds = bounds.Union(existing);
+                    return;
+                }
+            }
+
+            rects.push_back(rect);
+            bounds = bounds.Union(rect);
+        }
+
+        void DamageRegion::Clear() {
+            rects.clear();
+            bounds  = Rect();
+            full    = false;
+        }
+
+        void DamageTracker::Update(const Rect& rendered) {
+            resized = false;
+
+            if(rendered != bounds) {
+                // Stay dirty for one more frame so the new area gets repaired too
+                previous    = bounds;
+                bounds      = rendered;
+                dirty       = true;
+            } else {
+                previous    = bounds;
+                dirty       = false;
+            }
+        }
+
+        void DamageTracker::Collect(DamageRegion& region, bool animating) const {
+            if(!dirty && !animating) {
+                return;
+            }
+
+            if(resized) {
+                region.MarkFull();
+                return;
+            }
+
+            region.Add(previous.Union(bounds));
+
+            // Moving widgets: extrapolate where the next frame will land
+            if(animating && !previous.IsEmpty() && !bounds.IsEmpty()) {
+                float dx = bounds.x - previous.x;
+                float dy = bounds.y - previous.y;
+
+                if(dx != 0.0f || dy != 0.0f) {
+                    region.Add(Rect(bounds.x + dx, bounds.y + dy, bounds.width, bounds.height));
+                }
+            }
+        }
+    }
+}
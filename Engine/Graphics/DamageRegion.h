@@ -0,0 +1,52 @@
+#pragma once
+#include "Rect.h"
+#include <vector>
+
+namespace Engine {
+    namespace Graphics {
+        // Collects the regions of the window that changed since the last frame
+        class DamageRegion {
+            public:
+                void Add(const Rect& rect);
+                void MarkFull() { full = true; }
+                void Clear();
+
+                bool IsEmpty() const { return !full && rects.empty(); }
+                bool IsFull() const { return full; }
+
+                // Union of all damaged rects (ignores the full flag)
+                const Rect& GetBounds() const { return bounds; }
+                const std::vector<Rect>& GetRects() const { return rects; }
+
+            private:
+                std::vector<Rect> rects;
+                Rect bounds;
+                bool full = false;
+        };
+
+        // Per-widget bookkeeping: remembers where the widget was drawn last
+        class DamageTracker {
+            public:
+                void MarkDirty() { dirty = true; }
+                bool IsDirty() const { return dirty; }
+
+                // Geometry changed: the new bounds are only known after painting, so the
+                // next frame is redrawn in full instead of clipping the grown area
+                void MarkResized() { dirty = true; resized = true; }
+
+                // Called after rendering with the bounds that were actually drawn
+                void Update(const Rect& rendered);
+
+                // Adds old and new bounds if the widget changed or is animating, everything if it was resized
+                void Collect(DamageRegion& region, bool animating) const;
+
+                const Rect& GetBounds() const { return bounds; }
+
+            private:
+                Rect bounds;
+                Rect previous;
+                bool dirty = true;
+                bool resized = false;
+        };
+    }
+}
@@ -28,20 +28,14 @@ namespace Engine {
 
                 // Interpolate between colors for smooth transition
                 float t = colorIndex - std::floor(colorIndex);
-                IColor* color1 = colors[baseIndex];
-                IColor* color2 = colors[nextIndex];
-
-                // Apply subtle ambience color multiplication
-                float ambienceR = color1->GetRed() + (color2->GetRed() - color1->GetRed()) * t;
-                float ambienceG = color1->GetGreen() + (color2->GetGreen() - color1->GetGreen()) * t;
-                float ambienceB = color1->GetBlue() + (color2->GetBlue() - color1->GetBlue()) * t;
+                Color ambience = Color::Mix(colors[baseIndex], colors[nextIndex], t);
 
                 // Multiply with existing color for ambience effect
-                renderState.color = new RGBA(
-                    renderState.color->GetRed() * ambienceR * 255,
-                    renderState.color->GetGreen() * ambienceG * 255,
-                    renderState.color->GetBlue() * ambienceB * 255,
-                    renderState.color->GetAlpha() * 100
+                renderState.color = Color::FromFloats(
+                    renderState.color.GetRed() * ambience.GetRed(),
+                    renderState.color.GetGreen() * ambience.GetGreen(),
+                    renderState.color.GetBlue() * ambience.GetBlue(),
+                    renderState.color.GetAlpha()
                 );
             }
         }
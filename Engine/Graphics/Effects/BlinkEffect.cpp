@@ -20,17 +20,18 @@ namespace Engine {
                 
                 if (!HasStarted()) return;
                 
-                float effectTime = GetEffectTime();
-                
-                // Calculate blink alpha (0 = invisible, 1 = visible)
-                float phase = effectTime * frequency * 2.0f * M_PI;
-                float alpha = (std::sin(phase) + 1.0f) > 1.0f ? 1.0f : 0.0f; // Sharp on/off blink
-                
                 // Apply alpha to character color
-                renderState.color = new RGBA(renderState.color->GetRed() * 255,
-                                           renderState.color->GetGreen() * 255,
-                                           renderState.color->GetBlue() * 255,
-                                           renderState.color->GetAlpha() * alpha * 100);
+                renderState.color = renderState.color.MultiplyAlpha(GetAlpha(GetEffectTime()));
+            }
+
+            void BlinkEffect::ApplyToStream(GlyphStream& glyphs, float time) {
+                glyphs.Fade(GetAlpha(time));
+            }
+
+            float BlinkEffect::GetAlpha(float time) const {
+                // Calculate blink alpha (0 = invisible, 1 = visible)
+                float phase = time * frequency * 2.0f * M_PI;
+                return (std::sin(phase) + 1.0f) > 1.0f ? 1.0f : 0.0f; // Sharp on/off blink
             }
         }
     }
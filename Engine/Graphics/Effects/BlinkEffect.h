@@ -17,11 +17,15 @@ namespace Engine {
 
                 void Apply(Text& text, IRenderingAPI& context, float time, int charIndex) override;
                 void ApplyToCharacter(CharacterRenderState& renderState, int charIndex, float time) override;
+                void ApplyToStream(GlyphStream& glyphs, float time) override;
 
                 // Blink-specific parameters
                 void SetFrequency(float f) { frequency = f; }
 
             private:
+                // Alpha factor of the whole text at time, on or off
+                float GetAlpha(float time) const;
+
                 float frequency;    // Blink frequency in Hz
             };
         }
@@ -2,6 +2,7 @@
 #include "../UI/Text/Text.h"
 #include "../IRenderingAPI.h"
 #include "../UI/Animator.h"
+#include "../UI/EffectMath.h"
 
 namespace Engine {
     namespace Graphics {
@@ -24,16 +25,34 @@ namespace Engine {
                 }
 
                 // Create bounce using sine wave with easing
-                float bounce = std::sin(charTime * frequency) * intensity;
+                float wave = EffectMath::Sin(charTime * frequency);
 
                 // Apply easing to make bounce look more natural (stronger at peaks)
-                float easedBounce = bounce * std::abs(std::sin(charTime * frequency));
+                float easedBounce = wave * intensity * std::abs(wave);
 
                 // Only apply downward bounces (negative Y values for downward movement)
                 if (easedBounce > 0) {
                     renderState.y -= easedBounce;
                 }
             }
+
+            void BounceEffect::ApplyToStream(GlyphStream& glyphs, float time) {
+                size_t count = glyphs.Size();
+                FrameVector<float> waves(count, 0.0f, &FrameArena::Get());
+
+                for (size_t i = 0; i < count; ++i) {
+                    waves[i] = (time - (glyphs.index[i] * charDelay)) * frequency;
+                }
+
+                EffectMath::Sin(waves.data(), count);
+
+                // Characters that haven't started yet and upward halves stay put
+                for (size_t i = 0; i < count; ++i) {
+                    float easedBounce = waves[i] * intensity * std::abs(waves[i]);
+                    bool started = time - (glyphs.index[i] * charDelay) >= 0.0f;
+                    glyphs.y[i] -= (started && easedBounce > 0.0f) ? easedBounce : 0.0f;
+                }
+            }
         }
     }
 }
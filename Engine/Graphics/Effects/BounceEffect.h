@@ -14,6 +14,7 @@ namespace Engine {
 
                 void Apply(Text& text, IRenderingAPI& context, float time, int charIndex) override;
                 void ApplyToCharacter(CharacterRenderState& renderState, int charIndex, float time) override;
+                void ApplyToStream(GlyphStream& glyphs, float time) override;
 
                 // Bounce-specific parameters
                 void SetFrequency(float f) { frequency = f; }
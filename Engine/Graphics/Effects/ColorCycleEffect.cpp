@@ -34,15 +34,8 @@ namespace Engine {
 
                 // Interpolate between colors for smooth transition
                 float t = colorIndex - std::floor(colorIndex);
-                IColor* color1 = colors[baseIndex];
-                IColor* color2 = colors[nextIndex];
-
-                renderState.color = new RGBA(
-                    (color1->GetRed() + (color2->GetRed() - color1->GetRed()) * t) * 255,
-                    (color1->GetGreen() + (color2->GetGreen() - color1->GetGreen()) * t) * 255,
-                    (color1->GetBlue() + (color2->GetBlue() - color1->GetBlue()) * t) * 255,
-                    renderState.color->GetAlpha() * 100 // Preserve original alpha
-                );
+                // Preserve original alpha
+                renderState.color = Color::Mix(colors[baseIndex], colors[nextIndex], t).WithAlpha(renderState.color.GetAlpha());
             }
         }
     }
@@ -17,14 +17,17 @@ namespace Engine {
 
             void FadeInEffect::ApplyToCharacter(CharacterRenderState& renderState, int charIndex, float time) {
                 (void) charIndex;
-                // Calculate fade alpha (0.0 to 1.0)
-                float alpha = (duration > 0.0f) ? std::min(time / duration, 1.0f) : 1.0f;
-
                 // Apply alpha to character color
-                renderState.color = new RGBA(renderState.color->GetRed() * 255,
-                                       renderState.color->GetGreen() * 255,
-                                       renderState.color->GetBlue() * 255,
-                                       renderState.color->GetAlpha() * alpha * 100);
+                renderState.color = renderState.color.MultiplyAlpha(GetAlpha(time));
+            }
+
+            void FadeInEffect::ApplyToStream(GlyphStream& glyphs, float time) {
+                glyphs.Fade(GetAlpha(time));
+            }
+
+            float FadeInEffect::GetAlpha(float time) const {
+                // Calculate fade alpha (0.0 to 1.0)
+                return (duration > 0.0f) ? std::min(time / duration, 1.0f) : 1.0f;
             }
 
             void FadeOutEffect::Apply(Text& text, IRenderingAPI& context, float time, int charIndex) {
@@ -38,14 +41,17 @@ namespace Engine {
             void FadeOutEffect::ApplyToCharacter(CharacterRenderState& renderState, int charIndex, float time) {
                 (void) charIndex;
 
-                // Calculate fade alpha (1.0 to 0.0)
-                float alpha = (duration > 0.0f) ? std::max(1.0f - (time / duration), 0.0f) : 0.0f;
-
                 // Apply alpha to character color
-                renderState.color = new RGBA(renderState.color->GetRed() * 255,
-                                       renderState.color->GetGreen() * 255,
-                                       renderState.color->GetBlue() * 255,
-                                       renderState.color->GetAlpha() * alpha * 100);
+                renderState.color = renderState.color.MultiplyAlpha(GetAlpha(time));
+            }
+
+            void FadeOutEffect::ApplyToStream(GlyphStream& glyphs, float time) {
+                glyphs.Fade(GetAlpha(time));
+            }
+
+            float FadeOutEffect::GetAlpha(float time) const {
+                // Calculate fade alpha (1.0 to 0.0)
+                return (duration > 0.0f) ? std::max(1.0f - (time / duration), 0.0f) : 0.0f;
             }
         }
     }
@@ -12,6 +12,11 @@ namespace Engine {
 
                 void Apply(Text& text, IRenderingAPI& context, float time, int charIndex) override;
                 void ApplyToCharacter(CharacterRenderState& renderState, int charIndex, float time) override;
+                void ApplyToStream(GlyphStream& glyphs, float time) override;
+
+            private:
+                // Alpha of the text at time, 0 to 1
+                float GetAlpha(float time) const;
             };
 
             class FadeOutEffect : public TextEffect {
@@ -21,6 +26,11 @@ namespace Engine {
 
                 void Apply(Text& text, IRenderingAPI& context, float time, int charIndex) override;
                 void ApplyToCharacter(CharacterRenderState& renderState, int charIndex, float time) override;
+                void ApplyToStream(GlyphStream& glyphs, float time) override;
+
+            private:
+                // Alpha of the text at time, 1 to 0
+                float GetAlpha(float time) const;
             };
         }
     }
@@ -17,29 +17,33 @@ namespace Engine {
             void FadeSlideEffect::ApplyToCharacter(CharacterRenderState& renderState, int charIndex, float time) {
                 (void) charIndex;
 
+                renderState.color = renderState.color.MultiplyAlpha(GetAlpha(time));
+                renderState.x += GetSlide(time);
+            }
+
+            void FadeSlideEffect::ApplyToStream(GlyphStream& glyphs, float time) {
+                // All characters move together as one unit
+                glyphs.Fade(GetAlpha(time));
+                glyphs.Translate(GetSlide(time), 0.0f);
+            }
+
+            float FadeSlideEffect::GetProgress(float time) {
                 // Calculate progress for the entire text block (no character delay)
                 float progress = (duration > 0.0f) ? std::min(time / duration, 1.0f) : 1.0f;
 
                 // Apply easing for smooth animation
-                progress = EaseInOutQuad(progress);
-
-                // Apply fade effect to all characters equally
-                float alpha;
-                if (fadeOut) {
-                    alpha = 1.0f - progress; // Start visible, end invisible
-                } else {
-                    alpha = progress; // Start invisible, end visible
-                }
-
-                renderState.color = new RGBA(renderState.color->GetRed() * 255,
-                                       renderState.color->GetGreen() * 255,
-                                       renderState.color->GetBlue() * 255,
-                                       renderState.color->GetAlpha() * alpha * 100);
-
-                // Apply slide to the right for entire text block
-                // All characters move together as one unit
-                float slideOffset = slideDistance * progress;
-                renderState.x += slideOffset;
+                return EaseInOutQuad(progress);
+            }
+
+            float FadeSlideEffect::GetAlpha(float time) {
+                // Start visible and end invisible when fading out, the other way around when fading in
+                float progress = GetProgress(time);
+                return fadeOut ? 1.0f - progress : progress;
+            }
+
+            float FadeSlideEffect::GetSlide(float time) {
+                // Slide to the right for entire text block
+                return slideDistance * GetProgress(time);
             }
         }
     }
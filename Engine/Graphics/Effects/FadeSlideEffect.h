@@ -15,6 +15,7 @@ namespace Engine {
 
                 void Apply(Text& text, IRenderingAPI& context, float time, int charIndex) override;
                 void ApplyToCharacter(CharacterRenderState& renderState, int charIndex, float time) override;
+                void ApplyToStream(GlyphStream& glyphs, float time) override;
 
                 // FadeSlide-specific parameters
                 void SetSlideDistance(float dist) { slideDistance = dist; }
@@ -26,6 +27,11 @@ namespace Engine {
                 float charDelay;        // Delay between character animations
                 bool fadeOut;           // true = fade out, false = fade in
 
+                // Eased progress, alpha and slide of the whole text at time
+                float GetProgress(float time);
+                float GetAlpha(float time);
+                float GetSlide(float time);
+
                 float EaseInOutQuad(float t) {
                     return t < 0.5f ? 2.0f * t * t : 1.0f - std::pow(-2.0f * t + 2.0f, 2.0f) / 2.0f;
                 }
@@ -19,27 +19,41 @@ namespace Engine {
                 
                 if (!HasStarted()) return;
                 
-                float effectTime = GetEffectTime();
-                float progress = (duration > 0.0f) ? std::min(effectTime / duration, 1.0f) : 1.0f;
+                float dx, dy;
+                GetOffset(GetEffectTime(), dx, dy);
+                renderState.x += dx;
+                renderState.y += dy;
+            }
+
+            void MoveEffect::ApplyToStream(GlyphStream& glyphs, float time) {
+                float dx, dy;
+                GetOffset(time, dx, dy);
+                glyphs.Translate(dx, dy);
+            }
+
+            void MoveEffect::GetOffset(float time, float& dx, float& dy) {
+                float progress = (duration > 0.0f) ? std::min(time / duration, 1.0f) : 1.0f;
                 
                 // Apply easing
                 progress = EaseInOutQuad(progress);
                 
                 // Calculate offset (moves FROM start position TO target position)
                 float offset = moveDistance * progress;
+                dx = 0.0f;
+                dy = 0.0f;
                 
                 switch (direction) {
                     case MoveDirection::LEFT:
-                        renderState.x -= offset;  // Move left (negative X)
+                        dx = -offset;  // Move left (negative X)
                         break;
                     case MoveDirection::RIGHT:
-                        renderState.x += offset;  // Move right (positive X)
+                        dx = offset;   // Move right (positive X)
                         break;
                     case MoveDirection::UP:
-                        renderState.y -= offset;  // Move up (negative Y)
+                        dy = -offset;  // Move up (negative Y)
                         break;
                     case MoveDirection::DOWN:
-                        renderState.y += offset;  // Move down (positive Y)
+                        dy = offset;   // Move down (positive Y)
                         break;
                 }
             }
@@ -22,6 +22,7 @@ namespace Engine {
 
                 void Apply(Text& text, IRenderingAPI& context, float time, int charIndex) override;
                 void ApplyToCharacter(CharacterRenderState& renderState, int charIndex, float time) override;
+                void ApplyToStream(GlyphStream& glyphs, float time) override;
 
                 void SetDirection(MoveDirection dir) { direction = dir; }
                 void SetDistance(float dist) { moveDistance = dist; }
@@ -29,6 +30,9 @@ namespace Engine {
             private:
                 MoveDirection direction;
                 float moveDistance;
+
+                // Offset of the whole text at time
+                void GetOffset(float time, float& dx, float& dy);
                 
                 float EaseInOutQuad(float t) {
                     return t < 0.5f ? 2.0f * t * t : 1.0f - std::pow(-2.0f * t + 2.0f, 2.0f) / 2.0f;
@@ -20,15 +20,20 @@ namespace Engine {
                 
                 if (!HasStarted()) return;
                 
-                float effectTime = GetEffectTime();
-                
+                // Apply horizontal offset (positive = right, negative = left)
+                renderState.x += GetOffset(GetEffectTime());
+            }
+
+            void PendulumEffect::ApplyToStream(GlyphStream& glyphs, float time) {
+                // Every glyph swings together, the sine is taken once per text
+                glyphs.Translate(GetOffset(time), 0.0f);
+            }
+
+            float PendulumEffect::GetOffset(float time) const {
                 // Pendulum movement: Start at center (0), move right, then left, then back to center
                 // Using sine so it starts at 0 (center), goes to +1 (right), then -1 (left), then back to 0
-                float phase = effectTime * frequency * 2.0f * M_PI;
-                float offset = distance * std::sin(phase);
-                
-                // Apply horizontal offset (positive = right, negative = left)
-                renderState.x += offset;
+                float phase = time * frequency * 2.0f * M_PI;
+                return distance * std::sin(phase);
             }
         }
     }
@@ -19,12 +19,16 @@ namespace Engine {
 
                 void Apply(Text& text, IRenderingAPI& context, float time, int charIndex) override;
                 void ApplyToCharacter(CharacterRenderState& renderState, int charIndex, float time) override;
+                void ApplyToStream(GlyphStream& glyphs, float time) override;
 
                 // Pendulum-specific parameters
                 void SetDistance(float dist) { distance = dist; }
                 void SetFrequency(float freq) { frequency = freq; }
 
             private:
+                // Horizontal offset of the whole text at time
+                float GetOffset(float time) const;
+
                 float distance;     // Distance to move left/right
                 float frequency;    // How fast to swing (Hz)
             };
@@ -24,15 +24,15 @@ namespace Engine {
 
                 if (!HasStarted()) return;
                 
-                float effectTime = GetEffectTime();
-                
-                // Calculate pulse scale
-                float phase = effectTime * frequency * 2.0f * M_PI;
-                float oscillation = (std::sin(phase) + 1.0f) * 0.5f; // 0-1 range
-                float scale = minScale + oscillation * (maxScale - minScale);
-                
                 // Apply scale to character
-                renderState.scale *= scale;
+                renderState.scale *= GetCurrentScale();
+            }
+
+            void PulseEffect::ApplyToStream(GlyphStream& glyphs, float time) {
+                (void) time;
+
+                // The whole text pulses together
+                glyphs.Scale(GetCurrentScale());
             }
         }
     }
@@ -19,6 +19,7 @@ namespace Engine {
 
                 void Apply(Text& text, IRenderingAPI& context, float time, int charIndex) override;
                 void ApplyToCharacter(CharacterRenderState& renderState, int charIndex, float time) override;
+                void ApplyToStream(GlyphStream& glyphs, float time) override;
 
                 // Pulse-specific parameters
                 void SetScaleRange(float minS, float maxS) { minScale = minS; maxScale = maxS; }
@@ -2,6 +2,7 @@
 #include "../UI/Text/Text.h"
 #include "../IRenderingAPI.h"
 #include "../UI/Animator.h"
+#include "../UI/EffectMath.h"
 
 namespace Engine {
     namespace Graphics {
@@ -24,12 +25,29 @@ namespace Engine {
                 }
 
                 // Create scale oscillation using sine wave
-                float scaleOffset = (std::sin(charTime * frequency) + 1.0f) * 0.5f; // Normalize to 0-1
+                float scaleOffset = (EffectMath::Sin(charTime * frequency) + 1.0f) * 0.5f; // Normalize to 0-1
                 float scale = minScale + (maxScale - minScale) * scaleOffset;
 
                 // Apply scale to character
                 renderState.scale *= scale;
             }
+
+            void ScaleEffect::ApplyToStream(GlyphStream& glyphs, float time) {
+                size_t count = glyphs.Size();
+                FrameVector<float> waves(count, 0.0f, &FrameArena::Get());
+
+                for (size_t i = 0; i < count; ++i) {
+                    waves[i] = (time - (glyphs.index[i] * charDelay)) * frequency;
+                }
+
+                EffectMath::Sin(waves.data(), count);
+
+                for (size_t i = 0; i < count; ++i) {
+                    float scale = minScale + (maxScale - minScale) * (waves[i] + 1.0f) * 0.5f;
+                    bool started = time - (glyphs.index[i] * charDelay) >= 0.0f;
+                    glyphs.scale[i] *= started ? scale : 1.0f;
+                }
+            }
         }
     }
 }
@@ -15,6 +15,7 @@ namespace Engine {
 
                 void Apply(Text& text, IRenderingAPI& context, float time, int charIndex) override;
                 void ApplyToCharacter(CharacterRenderState& renderState, int charIndex, float time) override;
+                void ApplyToStream(GlyphStream& glyphs, float time) override;
 
                 // Scale-specific parameters
                 void SetScaleRange(float minS, float maxS) { minScale = minS; maxScale = maxS; }
@@ -20,12 +20,19 @@ namespace Engine {
                 
                 if (!HasStarted()) return;
                 
-                float effectTime = GetEffectTime();
-                
+                // Apply horizontal offset
+                renderState.x += GetOffset(GetEffectTime());
+            }
+
+            void ScanEffect::ApplyToStream(GlyphStream& glyphs, float time) {
+                glyphs.Translate(GetOffset(time), 0.0f);
+            }
+
+            float ScanEffect::GetOffset(float time) const {
                 // Scan movement: continuously move from left to right and back
                 // Using sawtooth wave: goes from -scanWidth/2 to +scanWidth/2 linearly, then jumps back
                 float period = 1.0f / frequency;
-                float t = fmod(effectTime, period) / period; // 0 to 1
+                float t = fmod(time, period) / period; // 0 to 1
                 
                 // Create sawtooth: 0->1->0 over one period
                 float sawtoothT;
@@ -36,10 +43,7 @@ namespace Engine {
                 }
                 
                 // Map to position: -scanWidth/2 to +scanWidth/2
-                float offset = (sawtoothT - 0.5f) * scanWidth;
-                
-                // Apply horizontal offset
-                renderState.x += offset;
+                return (sawtoothT - 0.5f) * scanWidth;
             }
         }
     }
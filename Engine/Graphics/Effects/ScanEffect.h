@@ -19,12 +19,16 @@ namespace Engine {
 
                 void Apply(Text& text, IRenderingAPI& context, float time, int charIndex) override;
                 void ApplyToCharacter(CharacterRenderState& renderState, int charIndex, float time) override;
+                void ApplyToStream(GlyphStream& glyphs, float time) override;
 
                 // Scan-specific parameters
                 void SetScanWidth(float width) { scanWidth = width; }
                 void SetFrequency(float freq) { frequency = freq; }
 
             private:
+                // Horizontal offset of the whole text at time
+                float GetOffset(float time) const;
+
                 float scanWidth;    // Total width to scan across
                 float frequency;    // How fast to scan (Hz)
             };
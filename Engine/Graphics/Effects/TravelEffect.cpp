@@ -19,21 +19,25 @@ namespace Engine {
                 
                 if (!HasStarted()) return;
                 
-                float effectTime = GetEffectTime();
-                float progress = (duration > 0.0f) ? std::min(effectTime / duration, 1.0f) : 1.0f;
+                renderState.x += GetOffset(GetEffectTime());
+            }
+
+            void TravelEffect::ApplyToStream(GlyphStream& glyphs, float time) {
+                glyphs.Translate(GetOffset(time), 0.0f);
+            }
+
+            float TravelEffect::GetOffset(float time) {
+                float progress = (duration > 0.0f) ? std::min(time / duration, 1.0f) : 1.0f;
                 
-                float offset;
                 if (progress <= 0.5f) {
                     // Erste Hälfte: Von 0 nach -travelDistance (nach links)
                     float halfProgress = progress * 2.0f; // 0 to 1
-                    offset = -travelDistance * EaseInOutQuad(halfProgress);
-                } else {
-                    // Zweite Hälfte: Von -travelDistance zurück nach 0 (nach rechts)
-                    float halfProgress = (progress - 0.5f) * 2.0f; // 0 to 1
-                    offset = -travelDistance * (1.0f - EaseInOutQuad(halfProgress));
+                    return -travelDistance * EaseInOutQuad(halfProgress);
                 }
-                
-                renderState.x += offset;
+
+                // Zweite Hälfte: Von -travelDistance zurück nach 0 (nach rechts)
+                float halfProgress = (progress - 0.5f) * 2.0f; // 0 to 1
+                return -travelDistance * (1.0f - EaseInOutQuad(halfProgress));
             }
         }
     }
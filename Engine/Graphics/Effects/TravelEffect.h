@@ -13,11 +13,15 @@ namespace Engine {
 
                 void Apply(Text& text, IRenderingAPI& context, float time, int charIndex) override;
                 void ApplyToCharacter(CharacterRenderState& renderState, int charIndex, float time) override;
+                void ApplyToStream(GlyphStream& glyphs, float time) override;
 
                 void SetDistance(float dist) { travelDistance = dist; }
 
             private:
                 float travelDistance;
+
+                // Horizontal offset of the whole text at time
+                float GetOffset(float time);
                 
                 float EaseInOutQuad(float t) {
                     return t < 0.5f ? 2.0f * t * t : 1.0f - std::pow(-2.0f * t + 2.0f, 2.0f) / 2.0f;
@@ -35,6 +35,15 @@ namespace Engine {
                 // TODO: Add cursor rendering logic - would need to add cursor character after this one
                 (void)shouldShowCursor; // For now, just suppress warning
             }
+
+            void TypewriterEffect::ApplyToStream(GlyphStream& glyphs, float time) {
+                // Characters past the ones typed so far are hidden
+                int visibleChars = static_cast<int>(time * charsPerSecond);
+
+                for (size_t i = 0; i < glyphs.Size(); ++i) {
+                    glyphs.visible[i] &= glyphs.index[i] < visibleChars ? 1 : 0;
+                }
+            }
         }
     }
 }
@@ -2,6 +2,7 @@
 #include "../UI/Text/Text.h"
 #include "../IRenderingAPI.h"
 #include "../UI/Animator.h"
+#include "../UI/EffectMath.h"
 
 namespace Engine {
     namespace Graphics {
@@ -16,12 +17,26 @@ namespace Engine {
 
             void WaveEffect::ApplyToCharacter(CharacterRenderState& renderState, int charIndex, float time) {
                 // Wave calculation: sin(time * frequency + charIndex * phase) * amplitude
-                float phase = 0.3f; // Phase offset between characters
-                float waveOffset = std::sin((time * frequency) + (charIndex * phase)) * intensity;
+                float waveOffset = EffectMath::Sin((time * frequency) + (charIndex * PHASE)) * intensity;
 
                 // Apply vertical offset to create wave motion
                 renderState.y += waveOffset;
             }
+
+            void WaveEffect::ApplyToStream(GlyphStream& glyphs, float time) {
+                size_t count = glyphs.Size();
+                FrameVector<float> waves(count, 0.0f, &FrameArena::Get());
+
+                for (size_t i = 0; i < count; ++i) {
+                    waves[i] = (time * frequency) + (glyphs.index[i] * PHASE);
+                }
+
+                EffectMath::Sin(waves.data(), count);
+
+                for (size_t i = 0; i < count; ++i) {
+                    glyphs.y[i] += waves[i] * intensity;
+                }
+            }
         }
     }
 }
@@ -14,6 +14,7 @@ namespace Engine {
 
                 void Apply(Text& text, IRenderingAPI& context, float time, int charIndex) override;
                 void ApplyToCharacter(CharacterRenderState& renderState, int charIndex, float time) override;
+                void ApplyToStream(GlyphStream& glyphs, float time) override;
 
                 // Wave-specific parameters
                 void SetFrequency(float f) { frequency = f; }
@@ -21,6 +22,8 @@ namespace Engine {
 
             private:
                 float frequency; // Wave frequency multiplier
+
+                static constexpr float PHASE = 0.3f;   // Phase offset between characters
             };
         }
     }
@@ -0,0 +1,268 @@
+#include "FrameCapture.h"
+#include "IRenderingAPI.h"
+#include "../Core/Engine.h"
+#include <iostream>
+#include <fstream>
+#include <filesystem>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include <stb_image_write.h>
+
+namespace Engine {
+    namespace Graphics {
+        namespace {
+            ImageFormat FormatFromPath(const std::string& path) {
+                std::string extension = std::filesystem::path(path).extension().string();
+                std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+
+                return extension == ".qoi" ? ImageFormat::QOI : ImageFormat::PNG;
+            }
+
+            // "Quite OK Image" format, see qoiformat.org
+            bool WriteQOI(const Image& image, const std::string& path) {
+                struct Pixel { uint8_t r, g, b, a; };
+
+                std::vector<uint8_t> out;
+                out.reserve(14 + image.pixels.size() / 2 + 8);
+
+                auto put32 = [&out](uint32_t value) {
+                    out.push_back(static_cast<uint8_t>(value >> 24));
+                    out.push_back(static_cast<uint8_t>(value >> 16));
+                    out.push_back(static_cast<uint8_t>(value >> 8));
+                    out.push_back(static_cast<uint8_t>(value));
+                };
+
+                out.insert(out.end(), { 'q', 'o', 'i', 'f' });
+                put32(static_cast<uint32_t>(image.width));
+                put32(static_cast<uint32_t>(image.height));
+                out.push_back(4); // RGBA
+                out.push_back(0); // sRGB
+
+                Pixel index[64];
+                std::memset(index, 0, sizeof(index));
+
+                Pixel previous = { 0, 0, 0, 255 };
+                int run = 0;
+
+                size_t count = static_cast<size_t>(image.width) * image.height;
+
+                for(size_t i = 0; i < count; i++) {
+                    const uint8_t* p = image.pixels.data() + i * 4;
+                    Pixel pixel = { p[0], p[1], p[2], p[3] };
+
+                    bool same = std::memcmp(&pixel, &previous, sizeof(Pixel)) == 0;
+
+                    if(same) {
+                        run++;
+
+                        if(run == 62 || i == count - 1) {
+                            out.push_back(static_cast<uint8_t>(0xc0 | (run - 1)));
+                            run = 0;
+                        }
+
+                        continue;
+                    }
+
+                    if(run > 0) {
+                        out.push_back(static_cast<uint8_t>(0xc0 | (run - 1)));
+                        run = 0;
+                    }
+
+                    int hash = (pixel.r * 3 + pixel.g * 5 + pixel.b * 7 + pixel.a * 11) % 64;
+
+                    if(std::memcmp(&index[hash], &pixel, sizeof(Pixel)) == 0) {
+                        out.push_back(static_cast<uint8_t>(hash));
+                    } else {
+                        index[hash] = pixel;
+
+                        if(pixel.a == previous.a) {
+                            int8_t vr   = static_cast<int8_t>(pixel.r - previous.r);
+                            int8_t vg   = static_cast<int8_t>(pixel.g - previous.g);
+                            int8_t vb   = static_cast<int8_t>(pixel.b - previous.b);
+                            int8_t vgr  = static_cast<int8_t>(vr - vg);
+                            int8_t vgb  = static_cast<int8_t>(vb - vg);
+
+                            if(vr > -3 && vr < 2 && vg > -3 && vg < 2 && vb > -3 && vb < 2) {
+                                out.push_back(static_cast<uint8_t>(0x40 | (vr + 2) << 4 | (vg + 2) << 2 | (vb + 2)));
+                            } else if(vgr > -9 && vgr < 8 && vg > -33 && vg < 32 && vgb > -9 && vgb < 8) {
+                                out.push_back(static_cast<uint8_t>(0x80 | (vg + 32)));
+                                out.push_back(static_cast<uint8_t>((vgr + 8) << 4 | (vgb + 8)));
+                            } else {
+                                out.insert(out.end(), { 0xfe, pixel.r, pixel.g, pixel.b });
+                            }
+                        } else {
+                            out.insert(out.end(), { 0xff, pixel.r, pixel.g, pixel.b, pixel.a });
+                        }
+                    }
+
+                    previous = pixel;
+                }
+
+                out.insert(out.end(), { 0, 0, 0, 0, 0, 0, 0, 1 });
+
+                std::ofstream file(path, std::ios::binary);
+
+                if(!file) {
+                    return false;
+                }
+
+                file.write(reinterpret_cast<const char*>(out.data()), static_cast<std::streamsize>(out.size()));
+                return file.good();
+            }
+        }
+
+        FrameCapture::~FrameCapture() {
+            Flush();
+        }
+
+        void FrameCapture::Screenshot(const std::string& path) {
+            std::lock_guard<std::mutex> lock(mutex);
+            requested.push_back({ path, FormatFromPath(path) });
+        }
+
+        void FrameCapture::StartRecording(const std::string& directory, int everyNthFrame, ImageFormat format) {
+            std::error_code error;
+            std::filesystem::create_directories(directory, error);
+
+            if(error) {
+                std::cout << "[FrameCapture] Can't create directory " << directory << ": " << error.message() << std::endl;
+                return;
+            }
+
+            std::lock_guard<std::mutex> lock(mutex);
+            recordDirectory = directory;
+            recordInterval  = std::max(1, everyNthFrame);
+            recordFormat    = format;
+            recordedFrames  = 0;
+            frameIndex      = 0;
+            recording       = true;
+
+            std::cout << "[FrameCapture] Recording every " << recordInterval << ". frame to " << directory << std::endl;
+        }
+
+        void FrameCapture::StopRecording() {
+            if(recording.exchange(false)) {
+                std::cout << "[FrameCapture] Recording stopped" << std::endl;
+            }
+        }
+
+        bool FrameCapture::IsBusy() const {
+            std::lock_guard<std::mutex> lock(mutex);
+            return recording || !requested.empty() || !inFlight.empty();
+        }
+
+        void FrameCapture::OnFrame(IRenderingAPI& context) {
+            std::vector<Output> outputs;
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                outputs.swap(requested);
+
+                if(recording && (frameIndex++ % recordInterval) == 0) {
+                    const char* extension = recordFormat == ImageFormat::QOI ? "qoi" : "png";
+                    char name[32];
+                    std::snprintf(name, sizeof(name), "frame_%06llu.%s", static_cast<unsigned long long>(++recordedFrames), extension);
+                    outputs.push_back({ (std::filesystem::path(recordDirectory) / name).string(), recordFormat });
+                }
+            }
+
+            // One readback per frame, shared by all outputs of that frame
+            if(!outputs.empty()) {
+                if(context.QueueReadback()) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    inFlight.push_back(std::move(outputs));
+                } else {
+                    dropped += outputs.size();
+                }
+            }
+
+            Collect(context);
+            PruneFinished();
+        }
+
+        void FrameCapture::Collect(IRenderingAPI& context) {
+            for(;;) {
+                std::vector<Output> outputs;
+
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+
+                    if(inFlight.empty()) {
+                        return;
+                    }
+                }
+
+                auto image = std::make_shared<Image>();
+
+                if(!context.CollectReadback(*image)) {
+                    return;
+                }
+
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    outputs = std::move(inFlight.front());
+                    inFlight.pop_front();
+                }
+
+                if(image->IsEmpty()) {
+                    dropped += outputs.size();
+                    continue;
+                }
+
+                captured++;
+
+                auto task = [this, image, outputs]() {
+                    for(const Output& output : outputs) {
+                        if(Encode(*image, output.path, output.format)) {
+                            written++;
+                        } else {
+                            dropped++;
+                            std::cout << "[FrameCapture] Can't write " << output.path << std::endl;
+                        }
+                    }
+                };
+
+                try {
+                    encoding.push_back(::Engine::Engine::GetInstance().GetThreadPool().Enqueue(task));
+                } catch(const std::exception&) {
+                    // Pool already stopped (shutdown), write on this thread
+                    task();
+                }
+            }
+        }
+
+        void FrameCapture::PruneFinished() {
+            encoding.erase(
+                std::remove_if(encoding.begin(), encoding.end(), [](std::future<void>& job) {
+                    return job.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+                }),
+                encoding.end()
+            );
+        }
+
+        void FrameCapture::Flush() {
+            for(std::future<void>& job : encoding) {
+                if(job.valid()) {
+                    job.wait();
+                }
+            }
+
+            encoding.clear();
+        }
+
+        bool FrameCapture::Encode(const Image& image, const std::string& path, ImageFormat format) {
+            if(image.IsEmpty()) {
+                return false;
+            }
+
+            if(format == ImageFormat::QOI) {
+                return WriteQOI(image, path);
+            }
+
+            return stbi_write_png(path.c_str(), image.width, image.height, 4, image.pixels.data(), static_cast<int>(image.GetStride())) != 0;
+        }
+    }
+}
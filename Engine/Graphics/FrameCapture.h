@@ -0,0 +1,81 @@
+#pragma once
+#include "Image.h"
+#include <string>
+#include <vector>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <atomic>
+#include <cstdint>
+
+namespace Engine {
+    namespace Graphics {
+        class IRenderingAPI;
+
+        enum class ImageFormat {
+            PNG,
+            QOI
+        };
+
+        /*
+         * Screenshots and continuous frame capture. Readback is queued on the
+         * frame that should be captured and collected a few frames later;
+         * encoding and writing runs on the engine's ThreadPool.
+         */
+        class FrameCapture {
+            public:
+                FrameCapture() = default;
+                ~FrameCapture();
+
+                // Format is taken from the extension (.qoi, everything else PNG)
+                void Screenshot(const std::string& path);
+
+                // Writes every Nth presented frame to directory/frame_000001.<ext>
+                void StartRecording(const std::string& directory, int everyNthFrame = 1, ImageFormat format = ImageFormat::QOI);
+                void StopRecording();
+                bool IsRecording() const { return recording; }
+
+                // True while captures are requested or waiting for readback
+                bool IsBusy() const;
+
+                // Called once per presented frame, right before SwapBuffers
+                void OnFrame(IRenderingAPI& context);
+
+                // Blocks until all queued images are written
+                void Flush();
+
+                // Statistics
+                uint64_t GetCaptured() const { return captured.load(); }
+                uint64_t GetWritten() const { return written.load(); }
+                uint64_t GetDropped() const { return dropped.load(); }
+
+                static bool Encode(const Image& image, const std::string& path, ImageFormat format);
+
+            private:
+                struct Output {
+                    std::string path;
+                    ImageFormat format;
+                };
+
+                void Collect(IRenderingAPI& context);
+                void PruneFinished();
+
+                mutable std::mutex mutex;
+                std::vector<Output> requested;
+                std::deque<std::vector<Output>> inFlight;
+                std::vector<std::future<void>> encoding;
+
+                // Continuous capture
+                std::atomic<bool> recording{false};
+                std::string recordDirectory;
+                ImageFormat recordFormat = ImageFormat::QOI;
+                int recordInterval = 1;
+                uint64_t frameIndex = 0;
+                uint64_t recordedFrames = 0;
+
+                std::atomic<uint64_t> captured{0};
+                std::atomic<uint64_t> written{0};
+                std::atomic<uint64_t> dropped{0};
+        };
+    }
+}
@@ -1,8 +1,14 @@
 #pragma once
 #include "IColor.h"
 #include "RGBA.h"
+#include "Color.h"
 #include "Texture.h"
+#include "RenderTarget.h"
+#include "Rect.h"
+#include "Image.h"
+#include "Shape.h"
 #include <string>
+#include <vector>
 #include <memory>
 
 namespace Engine {
@@ -16,6 +22,7 @@ namespace Engine {
 
                 virtual bool Available() = 0;
                 virtual std::string GetVersion() = 0;
+                virtual std::vector<std::string> GetFeatures() = 0;
                 virtual void CreateDevice() = 0;
                 virtual void GetDevice() = 0;
                 virtual void CreateContext() = 0;
@@ -28,7 +35,7 @@ namespace Engine {
 
                 // Rendering operations
                 virtual void Clear() = 0;
-                virtual void Clear(IColor* color) = 0;
+                virtual void Clear(Color color) = 0;
                 virtual void SwapBuffers() = 0;
 
                 // 2D rendering setup
@@ -36,22 +43,63 @@ namespace Engine {
                 virtual void End2D() = 0;
 
                 virtual Texture LoadTexture(const std::string& path) = 0;
+                virtual Texture CreateTexture(const Image& image) = 0;    // Uploads CPU pixels (linear filtered)
+                virtual void DestroyTexture(Texture& texture) = 0;
 
                 // Texture drawing
                 virtual void DrawTexture(const Texture& texture, float x, float y, float width, float height) = 0;
                 virtual void DrawTextureBlurred(const Texture& texture, float x, float y, float width, float height, float blurRadius = 2.0f) = 0;
 
+                // Offscreen rendering (BindRenderTarget(nullptr) restores the back buffer)
+                virtual RenderTarget CreateRenderTarget(int width, int height) = 0;
+                virtual void DestroyRenderTarget(RenderTarget& target) = 0;
+                virtual void BindRenderTarget(const RenderTarget* target) = 0;
+                virtual void DrawRenderTarget(const RenderTarget& target, float x, float y, float width, float height) = 0;
+                virtual const RenderTarget* GetRenderTarget() = 0;
+
+                // Draws into target with its own top-left projection, scissor off; EndOffscreen restores
+                // the target, viewport, projection and scissor from before. Nestable inside Begin2D/End2D.
+                virtual void BeginOffscreen(const RenderTarget& target) = 0;
+                virtual void EndOffscreen() = 0;
+
+                // Target holding premultiplied alpha (alpha blended content drawn on a transparent clear), batched
+                virtual void DrawPremultiplied(const RenderTarget& target, float x, float y, float width, float height) = 0;
+
+                // Scissor in window coordinates (nullptr disables it)
+                virtual void SetScissor(const Rect* rect) = 0;
+                virtual bool GetScissor(Rect& rect) = 0;
+
+                // Clip stack on top of the scissor: a pushed rect is intersected with the current clip,
+                // popping restores it. Widgets test against GetScissor to skip invisible items.
+                virtual void PushClip(const Rect& rect) = 0;
+                virtual void PopClip() = 0;
+
+                // Render queue: rects, textures and glyphs drawn inside Begin2D/End2D are sorted by layer,
+                // painter's depth, blend mode and texture. Any other call submits the queued quads first.
+                virtual void SetBatchLayer(int layer) = 0;
+
+                // Framebuffer readback: queue on the current frame, collect on a later one (FIFO)
+                virtual bool QueueReadback() = 0;
+                virtual bool CollectReadback(Image& image) = 0;
+
                 // Overlay effects
-                virtual void DrawDiagonalLines(float x, float y, float width, float height, float lineSpacing = 10.0f, float lineWidth = 1.0f, IColor* color = new RGBA(255, 255, 255, 10)) = 0;
-                virtual void DrawRadialLines(float x, float y, float width, float height, float centerX1, float centerY1, float centerX2, float centerY2, int numLines = 20, float lineWidth = 1.0f, IColor* color = new RGBA(255, 255, 255, 10)) = 0;
-                virtual void DrawVerticalLines(float x, float y, float width, float height, float lineSpacing = 15.0f, float lineWidth = 1.0f, IColor* color = new RGBA(255, 255, 255, 8)) = 0;
-                virtual void DrawHorizontalLines(float x, float y, float width, float height, float lineSpacing = 15.0f, float lineWidth = 1.0f, IColor* color = new RGBA(255, 255, 255, 8)) = 0;
+                virtual void DrawDiagonalLines(float x, float y, float width, float height, float lineSpacing = 10.0f, float lineWidth = 1.0f, Color color = Color(255, 255, 255, 10)) = 0;
+                virtual void DrawRadialLines(float x, float y, float width, float height, float centerX1, float centerY1, float centerX2, float centerY2, int numLines = 20, float lineWidth = 1.0f, Color color = Color(255, 255, 255, 10)) = 0;
+                virtual void DrawVerticalLines(float x, float y, float width, float height, float lineSpacing = 15.0f, float lineWidth = 1.0f, Color color = Color(255, 255, 255, 8)) = 0;
+                virtual void DrawHorizontalLines(float x, float y, float width, float height, float lineSpacing = 15.0f, float lineWidth = 1.0f, Color color = Color(255, 255, 255, 8)) = 0;
                 virtual void DrawFilmGrain(float x, float y, float width, float height, float intensity = 0.08f, int seed = 0) = 0;
 
                 // Primitive drawing
-                virtual void DrawRect(float x, float y, float width, float height, IColor* color) = 0;
-                virtual void DrawRectWithShadow(float x, float y, float width, float height, IColor* color, float shadowRadius, IColor* shadowColor, float shadowOffsetX = 0.0f, float shadowOffsetY = 0.0f) = 0;
-                virtual void PaintText(const std::string& text, float x, float y, IColor* color) = 0;
+                virtual void DrawRect(float x, float y, float width, float height, Color color) = 0;
+                virtual void DrawRectWithShadow(float x, float y, float width, float height, Color color, float shadowRadius, Color shadowColor, float shadowOffsetX = 0.0f, float shadowOffsetY = 0.0f) = 0;
+                virtual void DrawShape(const Shape& shape) = 0;    // One quad, evaluated per pixel
+                virtual void PaintText(const std::string& text, float x, float y, Color color) = 0;
+
+                // Alpha blended, tinted glyph quad (UVs of the top-left and bottom-right corner), rotated around its center
+                virtual void DrawGlyph(unsigned int texture, float x, float y, float width, float height, float u0, float v0, float u1, float v1, Color color, float rotation = 0.0f) = 0;
+
+                // Same for distance field glyphs: the edge is found per pixel, so the quad can be scaled without blurring
+                virtual void DrawDistanceGlyph(unsigned int texture, float x, float y, float width, float height, float u0, float v0, float u1, float v1, Color color, float rotation = 0.0f) = 0;
         };
     }
 }
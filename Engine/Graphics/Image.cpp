@@ -0,0 +1,28 @@
+#include "Image.h"
+#include <cstring>
+
+// Implementation is compiled into the OpenGL backend
+#include <stb_image.h>
+
+namespace Engine {
+    namespace Graphics {
+        bool Image::Load(const std::string& path, Image& image) {
+            int width       = 0;
+            int height      = 0;
+            int channels    = 0;
+            unsigned char* data = stbi_load(path.c_str(), &width, &height, &channels, 4);
+
+            if(!data) {
+                return false;
+            }
+
+            image.width     = width;
+            image.height    = height;
+            image.pixels.resize(image.GetStride() * height);
+            std::memcpy(image.pixels.data(), data, image.pixels.size());
+
+            stbi_image_free(data);
+            return true;
+        }
+    }
+}
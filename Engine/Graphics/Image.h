@@ -0,0 +1,23 @@
+#pragma once
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstddef>
+
+namespace Engine {
+    namespace Graphics {
+        // CPU-side RGBA8 pixels, rows top-down
+        class Image {
+            public:
+                int width   = 0;
+                int height  = 0;
+                std::vector<uint8_t> pixels;
+
+                bool IsEmpty() const { return width <= 0 || height <= 0 || pixels.empty(); }
+                size_t GetStride() const { return static_cast<size_t>(width) * 4; }
+
+                // Decodes a PNG/JPG/... file into RGBA8, false if it can't be read
+                static bool Load(const std::string& path, Image& image);
+        };
+    }
+}
@@ -0,0 +1,74 @@
+#include "Layer.h"
+#include "IRenderingAPI.h"
+
+namespace Engine {
+    namespace Graphics {
+        std::atomic<uint64_t> Layer::hits{0};
+        std::atomic<uint64_t> Layer::misses{0};
+
+        Layer::Layer(const std::string& name) : name(name) {
+            /* Do Nothing */
+        }
+
+        Layer::~Layer() {
+            Release();
+        }
+
+        void Layer::Release() {
+            if(owner && target.IsValid()) {
+                owner->DestroyRenderTarget(target);
+            }
+
+            owner = nullptr;
+            dirty = true;
+        }
+
+        bool Layer::Render(IRenderingAPI& context, int width, int height, const std::function<void(IRenderingAPI&)>& paint) {
+            if(!dirty && target.IsValid() && target.width == width && target.height == height) {
+                hits++;
+                context.DrawRenderTarget(target, 0.0f, 0.0f, static_cast<float>(width), static_cast<float>(height));
+                return true;
+            }
+
+            misses++;
+
+            if(!target.IsValid() || target.width != width || target.height != height) {
+                Release();
+                target = context.CreateRenderTarget(width, height);
+                owner = &context;
+            }
+
+            // No offscreen support: paint straight into the back buffer
+            if(!target.IsValid()) {
+                paint(context);
+                return false;
+            }
+
+            // Layers are always painted completely, whatever surface or scissor is active
+            const RenderTarget* previousTarget = context.GetRenderTarget();
+            Rect previousScissor;
+            bool scissored = context.GetScissor(previousScissor);
+
+            context.SetScissor(nullptr);
+            context.BindRenderTarget(&target);
+            context.Begin2D(width, height);
+            paint(context);
+            context.BindRenderTarget(previousTarget);
+            context.Begin2D(width, height);
+
+            if(scissored) {
+                context.SetScissor(&previousScissor);
+            }
+
+            dirty = false;
+
+            context.DrawRenderTarget(target, 0.0f, 0.0f, static_cast<float>(width), static_cast<float>(height));
+            return false;
+        }
+
+        void Layer::ResetStatistics() {
+            hits    = 0;
+            misses  = 0;
+        }
+    }
+}
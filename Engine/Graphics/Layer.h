@@ -0,0 +1,48 @@
+#pragma once
+#include "RenderTarget.h"
+#include <string>
+#include <atomic>
+#include <functional>
+#include <cstdint>
+
+namespace Engine {
+    namespace Graphics {
+        class IRenderingAPI;
+
+        /*
+         * Cached render layer: content is painted once into an offscreen
+         * target and reused until the size changes or Invalidate() is called.
+         * Without framebuffer support the paint callback runs every frame.
+         */
+        class Layer {
+            public:
+                explicit Layer(const std::string& name);
+                ~Layer();
+
+                Layer(const Layer&) = delete;
+                Layer& operator=(const Layer&) = delete;
+
+                // Returns true if the cached content was reused
+                bool Render(IRenderingAPI& context, int width, int height, const std::function<void(IRenderingAPI&)>& paint);
+                void Invalidate() { dirty = true; }
+                bool IsDirty() const { return dirty; }
+                void Release();
+
+                const std::string& GetName() const { return name; }
+
+                // Global statistics
+                static uint64_t GetHits() { return hits.load(); }
+                static uint64_t GetMisses() { return misses.load(); }
+                static void ResetStatistics();
+
+            private:
+                std::string name;
+                RenderTarget target;
+                IRenderingAPI* owner = nullptr;
+                bool dirty = true;
+
+                static std::atomic<uint64_t> hits;
+                static std::atomic<uint64_t> misses;
+        };
+    }
+}
@@ -0,0 +1,533 @@
+#include "Null.h"
+#include "../../Core/NativeWindow.h"
+#include "../RenderStats.h"
+#include <iostream>
+#include <cstring>
+#include <algorithm>
+
+namespace Engine {
+    namespace Graphics {
+        namespace Null {
+            Null::Null(int width, int height) : width(width), height(height) {
+                /* Do Nothing */
+            }
+
+            bool Null::Init(std::shared_ptr<NativeWindow> window) {
+                if(window) {
+                    const auto& props = window->GetProperties();
+                    width   = props.width;
+                    height  = props.height;
+                }
+
+                std::cout << "[Null] Initialized (" << width << "x" << height << "), nothing will be drawn" << std::endl;
+                return true;
+            }
+
+            bool Null::Available() {
+                return true;
+            }
+
+            std::string Null::GetVersion() {
+                return "Null 1.0";
+            }
+
+            std::vector<std::string> Null::GetFeatures() {
+                return {};
+            }
+
+            void Null::CreateDevice() {
+                /* Do Nothing */
+            }
+
+            void Null::GetDevice() {
+                /* Do Nothing */
+            }
+
+            void Null::CreateContext() {
+                /* Do Nothing */
+            }
+
+            void Null::GetContext() {
+                /* Do Nothing */
+            }
+
+            void Null::SetViewport(int width, int height) {
+                Record(Call::SET_VIEWPORT, { 0.0f, 0.0f, static_cast<float>(width), static_cast<float>(height) });
+            }
+
+            void Null::SetViewport(int x, int y, int width, int height) {
+                Record(Call::SET_VIEWPORT, { static_cast<float>(x), static_cast<float>(y), static_cast<float>(width), static_cast<float>(height) });
+            }
+
+            int Null::GetWidth() {
+                return width;
+            }
+
+            int Null::GetHeight() {
+                return height;
+            }
+
+            void Null::Clear() {
+                Record(Call::CLEAR, {});
+            }
+
+            void Null::Clear(Color color) {
+                Record(Call::CLEAR, {}, &color);
+            }
+
+            void Null::SwapBuffers() {
+                Record(Call::SWAP_BUFFERS, {});
+
+                frameHash           = currentFrameHash;
+                currentFrameHash    = HASH_OFFSET;
+                frames++;
+            }
+
+            void Null::Begin2D(int width, int height) {
+                Record(Call::BEGIN_2D, { static_cast<float>(width), static_cast<float>(height) });
+                FlushBatch();
+                batchDepth++;
+            }
+
+            void Null::End2D() {
+                Record(Call::END_2D, {});
+                FlushBatch();
+                batchDepth = std::max(0, batchDepth - 1);
+            }
+
+            Texture Null::LoadTexture(const std::string& path) {
+                Record(Call::LOAD_TEXTURE, {}, nullptr, &path);
+
+                Texture texture{};
+                texture.id      = nextHandle++;
+                texture.name    = path;
+                texture.width   = 1;
+                texture.height  = 1;
+                return texture;
+            }
+
+            Texture Null::CreateTexture(const Image& image) {
+                Record(Call::CREATE_TEXTURE, { static_cast<float>(image.width), static_cast<float>(image.height) });
+
+                Texture texture{};
+                texture.id      = nextHandle++;
+                texture.width   = image.width;
+                texture.height  = image.height;
+                return texture;
+            }
+
+            void Null::DestroyTexture(Texture& texture) {
+                if(texture.id == 0) {
+                    return;
+                }
+
+                Record(Call::DESTROY_TEXTURE, { static_cast<float>(texture.id) });
+                texture = Texture{};
+            }
+
+            void Null::DrawTexture(const Texture& texture, float x, float y, float width, float height) {
+                Record(Call::DRAW_TEXTURE, { static_cast<float>(texture.id), x, y, width, height });
+
+                if(batchDepth > 0) {
+                    QuadCommand command;
+                    command.texture = texture.id;
+                    command.blend   = BlendMode::NONE;
+                    command.SetRect(x, y, width, height);
+                    command.SetTexCoords(0.0f, 0.0f, 1.0f, 1.0f);
+                    Submit(command);
+                }
+            }
+
+            void Null::DrawTextureBlurred(const Texture& texture, float x, float y, float width, float height, float blurRadius) {
+                Record(Call::DRAW_TEXTURE_BLURRED, { static_cast<float>(texture.id), x, y, width, height, blurRadius });
+            }
+
+            RenderTarget Null::CreateRenderTarget(int width, int height) {
+                Record(Call::CREATE_RENDER_TARGET, { static_cast<float>(width), static_cast<float>(height) });
+
+                RenderTarget target{};
+
+                if(width <= 0 || height <= 0) {
+                    return target;
+                }
+
+                target.framebuffer      = nextHandle++;
+                target.texture.id       = nextHandle++;
+                target.texture.width    = width;
+                target.texture.height   = height;
+                target.width            = width;
+                target.height           = height;
+                return target;
+            }
+
+            void Null::DestroyRenderTarget(RenderTarget& target) {
+                if(!target.IsValid()) {
+                    return;
+                }
+
+                Record(Call::DESTROY_RENDER_TARGET, { static_cast<float>(target.framebuffer) });
+                target = RenderTarget{};
+            }
+
+            void Null::BindRenderTarget(const RenderTarget* target) {
+                Record(Call::BIND_RENDER_TARGET, { target ? static_cast<float>(target->framebuffer) : 0.0f });
+                boundTarget = (target && target->IsValid()) ? target : nullptr;
+            }
+
+            void Null::DrawRenderTarget(const RenderTarget& target, float x, float y, float width, float height) {
+                Record(Call::DRAW_RENDER_TARGET, { static_cast<float>(target.framebuffer), x, y, width, height });
+            }
+
+            const RenderTarget* Null::GetRenderTarget() {
+                return boundTarget;
+            }
+
+            void Null::BeginOffscreen(const RenderTarget& target) {
+                Record(Call::BEGIN_OFFSCREEN, { static_cast<float>(target.framebuffer), static_cast<float>(target.width), static_cast<float>(target.height) });
+                offscreenStack.push_back(boundTarget);
+                boundTarget = target.IsValid() ? &target : nullptr;
+            }
+
+            void Null::EndOffscreen() {
+                Record(Call::END_OFFSCREEN, {});
+
+                if(!offscreenStack.empty()) {
+                    boundTarget = offscreenStack.back();
+                    offscreenStack.pop_back();
+                }
+            }
+
+            void Null::DrawPremultiplied(const RenderTarget& target, float x, float y, float width, float height) {
+                Record(Call::DRAW_PREMULTIPLIED, { static_cast<float>(target.framebuffer), x, y, width, height });
+            }
+
+            void Null::SetScissor(const Rect* rect) {
+                if(rect) {
+                    Record(Call::SET_SCISSOR, { rect->x, rect->y, rect->width, rect->height });
+                    scissorRect = *rect;
+                } else {
+                    Record(Call::SET_SCISSOR, {});
+                }
+
+                scissorEnabled = rect != nullptr;
+            }
+
+            bool Null::GetScissor(Rect& rect) {
+                if(scissorEnabled) {
+                    rect = scissorRect;
+                }
+
+                return scissorEnabled;
+            }
+
+            void Null::PushClip(const Rect& rect) {
+                // Disjoint clips leave an empty rect, which hides everything
+                Rect clip = scissorEnabled ? scissorRect.Intersection(rect) : rect;
+
+                clipStack.push_back({ scissorEnabled, scissorRect });
+                SetScissor(&clip);
+            }
+
+            void Null::PopClip() {
+                if(clipStack.empty()) {
+                    return;
+                }
+
+                ClipState previous = clipStack.back();
+                clipStack.pop_back();
+
+                SetScissor(previous.enabled ? &previous.rect : nullptr);
+            }
+
+            bool Null::QueueReadback() {
+                Record(Call::QUEUE_READBACK, {});
+                pendingReadbacks++;
+                return true;
+            }
+
+            bool Null::CollectReadback(Image& image) {
+                if(pendingReadbacks == 0) {
+                    return false;
+                }
+
+                pendingReadbacks--;
+
+                // Nothing was drawn, the frame is plain black
+                image.width     = width;
+                image.height    = height;
+                image.pixels.assign(image.GetStride() * height, 0);
+
+                for(size_t alpha = 3; alpha < image.pixels.size(); alpha += 4) {
+                    image.pixels[alpha] = 255;
+                }
+
+                return true;
+            }
+
+            void Null::DrawDiagonalLines(float x, float y, float width, float height, float lineSpacing, float lineWidth, Color color) {
+                Record(Call::DRAW_DIAGONAL_LINES, { x, y, width, height, lineSpacing, lineWidth }, &color);
+            }
+
+            void Null::DrawRadialLines(float x, float y, float width, float height, float centerX1, float centerY1, float centerX2, float centerY2, int numLines, float lineWidth, Color color) {
+                Record(Call::DRAW_RADIAL_LINES, { x, y, width, height, centerX1, centerY1, centerX2, centerY2, static_cast<float>(numLines), lineWidth }, &color);
+            }
+
+            void Null::DrawVerticalLines(float x, float y, float width, float height, float lineSpacing, float lineWidth, Color color) {
+                Record(Call::DRAW_VERTICAL_LINES, { x, y, width, height, lineSpacing, lineWidth }, &color);
+            }
+
+            void Null::DrawHorizontalLines(float x, float y, float width, float height, float lineSpacing, float lineWidth, Color color) {
+                Record(Call::DRAW_HORIZONTAL_LINES, { x, y, width, height, lineSpacing, lineWidth }, &color);
+            }
+
+            void Null::DrawFilmGrain(float x, float y, float width, float height, float intensity, int seed) {
+                Record(Call::DRAW_FILM_GRAIN, { x, y, width, height, intensity, static_cast<float>(seed) });
+            }
+
+            void Null::DrawRect(float x, float y, float width, float height, Color color) {
+                Record(Call::DRAW_RECT, { x, y, width, height }, &color);
+
+                if(batchDepth > 0) {
+                    QuadCommand command;
+                    command.SetRect(x, y, width, height);
+                    command.SetColor(color);
+                    Submit(command);
+                }
+            }
+
+            void Null::DrawRectWithShadow(float x, float y, float width, float height, Color color, float shadowRadius, Color shadowColor, float shadowOffsetX, float shadowOffsetY) {
+                Record(Call::DRAW_RECT_WITH_SHADOW, { x, y, width, height, shadowRadius, shadowOffsetX, shadowOffsetY }, &color);
+
+                // Shadow color goes into the hash as well
+                if(hashing) {
+                    float channels[4] = { shadowColor.GetRed(), shadowColor.GetGreen(), shadowColor.GetBlue(), shadowColor.GetAlpha() };
+                    Hash(channels, sizeof(channels));
+                }
+            }
+
+            void Null::DrawShape(const Shape& shape) {
+                Record(Call::DRAW_SHAPE, { static_cast<float>(shape.type), shape.bounds.x, shape.bounds.y, shape.bounds.width, shape.bounds.height,
+                    shape.radius, shape.borderWidth, shape.softness, static_cast<float>(shape.gradient) });
+
+                // Colors go into the hash as well
+                if(hashing) {
+                    Hash(shape.fill, sizeof(shape.fill));
+                    Hash(shape.border, sizeof(shape.border));
+                    Hash(shape.gradientColor, sizeof(shape.gradientColor));
+                }
+            }
+
+            void Null::PaintText(const std::string& text, float x, float y, Color color) {
+                Record(Call::PAINT_TEXT, { x, y }, &color, &text);
+            }
+
+            void Null::DrawGlyph(unsigned int texture, float x, float y, float width, float height, float u0, float v0, float u1, float v1, Color color, float rotation) {
+                Record(Call::DRAW_GLYPH, { static_cast<float>(texture), x, y, width, height, u0, v0, u1, v1, rotation }, &color);
+
+                if(batchDepth > 0) {
+                    QuadCommand command;
+                    command.texture = texture;
+                    command.SetRect(x, y, width, height);
+                    command.SetTexCoords(u0, v0, u1, v1);
+                    command.SetColor(color);
+                    command.Rotate(rotation);
+                    Submit(command);
+                }
+            }
+
+            void Null::DrawDistanceGlyph(unsigned int texture, float x, float y, float width, float height, float u0, float v0, float u1, float v1, Color color, float rotation) {
+                Record(Call::DRAW_DISTANCE_GLYPH, { static_cast<float>(texture), x, y, width, height, u0, v0, u1, v1, rotation }, &color);
+
+                if(batchDepth > 0) {
+                    QuadCommand command;
+                    command.texture = texture;
+                    command.blend   = BlendMode::DISTANCE;
+                    command.SetRect(x, y, width, height);
+                    command.SetTexCoords(u0, v0, u1, v1);
+                    command.SetColor(color);
+                    command.Rotate(rotation);
+                    Submit(command);
+                }
+            }
+
+            void Null::SetBatchLayer(int layer) {
+                Record(Call::SET_BATCH_LAYER, { static_cast<float>(layer) });
+                queue.SetLayer(layer);
+            }
+
+            void Null::Submit(const QuadCommand& command) {
+                if(scissorEnabled && !scissorRect.Intersects(command.GetBounds())) {
+                    RenderStats::GetInstance().AddCulled();
+                    return;
+                }
+
+                if(!queue.Submit(command)) {
+                    FlushBatch();
+                    queue.Submit(command);
+                }
+            }
+
+            void Null::FlushBatch() {
+                if(!queue.IsEmpty()) {
+                    queue.Sort();
+                    queue.Clear();
+                }
+            }
+
+            void Null::Record(Call call, std::initializer_list<float> arguments, const Color* color, const std::string* text) {
+                counts[static_cast<int>(call)]++;
+
+                // Anything that isn't a queued quad ends the current batch
+                switch(call) {
+                    case Call::DRAW_RECT:
+                    case Call::DRAW_TEXTURE:
+                    case Call::DRAW_GLYPH:
+                    case Call::DRAW_DISTANCE_GLYPH:
+                    case Call::SET_BATCH_LAYER:
+                    case Call::BEGIN_2D:
+                    case Call::END_2D:
+                    break;
+
+                    default:
+                        FlushBatch();
+                    break;
+                }
+
+                if(!hashing && !recording) {
+                    return;
+                }
+
+                float channels[4] = {};
+
+                if(color) {
+                    channels[0] = color->GetRed();
+                    channels[1] = color->GetGreen();
+                    channels[2] = color->GetBlue();
+                    channels[3] = color->GetAlpha();
+                }
+
+                if(hashing) {
+                    int id = static_cast<int>(call);
+                    Hash(&id, sizeof(id));
+
+                    for(float argument : arguments) {
+                        Hash(&argument, sizeof(argument));
+                    }
+
+                    if(color) {
+                        Hash(channels, sizeof(channels));
+                    }
+
+                    if(text) {
+                        Hash(text->data(), text->size());
+                    }
+                }
+
+                if(recording) {
+                    Command command;
+                    command.call = call;
+                    command.arguments.assign(arguments.begin(), arguments.end());
+
+                    if(color) {
+                        command.arguments.insert(command.arguments.end(), channels, channels + 4);
+                    }
+
+                    if(text) {
+                        command.text = *text;
+                    }
+
+                    commands.push_back(std::move(command));
+                }
+            }
+
+            void Null::Hash(const void* data, size_t size) {
+                const unsigned char* bytes = static_cast<const unsigned char*>(data);
+
+                for(size_t index = 0; index < size; index++) {
+                    streamHash          = (streamHash ^ bytes[index]) * HASH_PRIME;
+                    currentFrameHash    = (currentFrameHash ^ bytes[index]) * HASH_PRIME;
+                }
+            }
+
+            uint64_t Null::GetCallCount(Call call) const {
+                if(call == Call::COUNT) {
+                    return 0;
+                }
+
+                return counts[static_cast<int>(call)];
+            }
+
+            uint64_t Null::GetTotalCalls() const {
+                uint64_t total = 0;
+
+                for(uint64_t count : counts) {
+                    total += count;
+                }
+
+                return total;
+            }
+
+            void Null::Reset() {
+                std::memset(counts, 0, sizeof(counts));
+                commands.clear();
+                frames              = 0;
+                streamHash          = HASH_OFFSET;
+                currentFrameHash    = HASH_OFFSET;
+                frameHash           = HASH_OFFSET;
+            }
+
+            void Null::PrintStatistics() const {
+                std::cout << "[Null] " << GetTotalCalls() << " calls in " << frames << " frames" << std::endl;
+
+                for(int index = 0; index < static_cast<int>(Call::COUNT); index++) {
+                    if(counts[index] > 0) {
+                        std::cout << "\t- " << GetCallName(static_cast<Call>(index)) << ": " << counts[index] << std::endl;
+                    }
+                }
+
+                if(hashing) {
+                    std::cout << "[Null] Stream hash: " << std::hex << streamHash << ", last frame: " << frameHash << std::dec << std::endl;
+                }
+            }
+
+            const char* Null::GetCallName(Call call) {
+                switch(call) {
+                    case Call::CLEAR:                   return "Clear";
+                    case Call::SWAP_BUFFERS:            return "SwapBuffers";
+                    case Call::SET_VIEWPORT:            return "SetViewport";
+                    case Call::BEGIN_2D:                return "Begin2D";
+                    case Call::END_2D:                  return "End2D";
+                    case Call::LOAD_TEXTURE:            return "LoadTexture";
+                    case Call::DRAW_TEXTURE:            return "DrawTexture";
+                    case Call::DRAW_TEXTURE_BLURRED:    return "DrawTextureBlurred";
+                    case Call::CREATE_RENDER_TARGET:    return "CreateRenderTarget";
+                    case Call::DESTROY_RENDER_TARGET:   return "DestroyRenderTarget";
+                    case Call::BIND_RENDER_TARGET:      return "BindRenderTarget";
+                    case Call::DRAW_RENDER_TARGET:      return "DrawRenderTarget";
+                    case Call::BEGIN_OFFSCREEN:         return "BeginOffscreen";
+                    case Call::END_OFFSCREEN:           return "EndOffscreen";
+                    case Call::DRAW_PREMULTIPLIED:      return "DrawPremultiplied";
+                    case Call::SET_SCISSOR:             return "SetScissor";
+                    case Call::QUEUE_READBACK:          return "QueueReadback";
+                    case Call::DRAW_DIAGONAL_LINES:     return "DrawDiagonalLines";
+                    case Call::DRAW_RADIAL_LINES:       return "DrawRadialLines";
+                    case Call::DRAW_VERTICAL_LINES:     return "DrawVerticalLines";
+                    case Call::DRAW_HORIZONTAL_LINES:   return "DrawHorizontalLines";
+                    case Call::DRAW_FILM_GRAIN:         return "DrawFilmGrain";
+                    case Call::DRAW_RECT:               return "DrawRect";
+                    case Call::DRAW_RECT_WITH_SHADOW:   return "DrawRectWithShadow";
+                    case Call::PAINT_TEXT:              return "PaintText";
+                    case Call::SET_BATCH_LAYER:         return "SetBatchLayer";
+                    case Call::DRAW_GLYPH:              return "DrawGlyph";
+                    case Call::DRAW_DISTANCE_GLYPH:     return "DrawDistanceGlyph";
+                    case Call::DRAW_SHAPE:              return "DrawShape";
+                    case Call::CREATE_TEXTURE:          return "CreateTexture";
+                    case Call::DESTROY_TEXTURE:         return "DestroyTexture";
+                    case Call::COUNT:                   break;
+                }
+
+                return "Unknown";
+            }
+        }
+    }
+}
@@ -0,0 +1,202 @@
+#pragma once
+
+#include "../IRenderingAPI.h"
+#include "../RenderQueue.h"
+#include <string>
+#include <memory>
+#include <vector>
+#include <deque>
+#include <cstdint>
+#include <initializer_list>
+
+namespace Engine {
+    class NativeWindow;
+
+    namespace Graphics {
+        namespace Null {
+            enum class Call {
+                CLEAR,
+                SWAP_BUFFERS,
+                SET_VIEWPORT,
+                BEGIN_2D,
+                END_2D,
+                LOAD_TEXTURE,
+                DRAW_TEXTURE,
+                DRAW_TEXTURE_BLURRED,
+                CREATE_RENDER_TARGET,
+                DESTROY_RENDER_TARGET,
+                BIND_RENDER_TARGET,
+                DRAW_RENDER_TARGET,
+                BEGIN_OFFSCREEN,
+                END_OFFSCREEN,
+                DRAW_PREMULTIPLIED,
+                SET_SCISSOR,
+                QUEUE_READBACK,
+                DRAW_DIAGONAL_LINES,
+                DRAW_RADIAL_LINES,
+                DRAW_VERTICAL_LINES,
+                DRAW_HORIZONTAL_LINES,
+                DRAW_FILM_GRAIN,
+                DRAW_RECT,
+                DRAW_RECT_WITH_SHADOW,
+                PAINT_TEXT,
+                SET_BATCH_LAYER,
+                DRAW_GLYPH,
+                DRAW_DISTANCE_GLYPH,
+                DRAW_SHAPE,
+                CREATE_TEXTURE,
+                DESTROY_TEXTURE,
+                COUNT
+            };
+
+            // One recorded call with its arguments (colors are stored as four floats)
+            struct Command {
+                Call call;
+                std::vector<float> arguments;
+                std::string text;
+            };
+
+            /*
+             * Rendering backend that draws nothing. It counts every call and can
+             * record the arguments and hash the call stream, so the CPU cost of
+             * views can be measured and rendering changes detected by comparing
+             * frame hashes.
+             */
+            class Null : public IRenderingAPI {
+            public:
+                Null(int width = 1280, int height = 720);
+                virtual ~Null() = default;
+                bool Init(std::shared_ptr<NativeWindow> window) override;
+
+                bool Available() override;
+                std::string GetVersion() override;
+                std::vector<std::string> GetFeatures() override;
+                void CreateDevice() override;
+                void GetDevice() override;
+                void CreateContext() override;
+                void GetContext() override;
+
+                void SetViewport(int width, int height) override;
+                void SetViewport(int x, int y, int width, int height) override;
+                int GetWidth() override;
+                int GetHeight() override;
+
+                // Rendering operations
+                void Clear() override;
+                void Clear(Color color) override;
+                void SwapBuffers() override;
+
+                // 2D rendering setup
+                void Begin2D(int width, int height) override;
+                void End2D() override;
+
+                Texture LoadTexture(const std::string& path) override;
+                Texture CreateTexture(const Image& image) override;
+                void DestroyTexture(Texture& texture) override;
+
+                // Texture drawing
+                void DrawTexture(const Texture& texture, float x, float y, float width, float height) override;
+                void DrawTextureBlurred(const Texture& texture, float x, float y, float width, float height, float blurRadius = 2.0f) override;
+
+                // Offscreen rendering
+                RenderTarget CreateRenderTarget(int width, int height) override;
+                void DestroyRenderTarget(RenderTarget& target) override;
+                void BindRenderTarget(const RenderTarget* target) override;
+                void DrawRenderTarget(const RenderTarget& target, float x, float y, float width, float height) override;
+                const RenderTarget* GetRenderTarget() override;
+                void BeginOffscreen(const RenderTarget& target) override;
+                void EndOffscreen() override;
+                void DrawPremultiplied(const RenderTarget& target, float x, float y, float width, float height) override;
+
+                // Scissor
+                void SetScissor(const Rect* rect) override;
+                bool GetScissor(Rect& rect) override;
+                void PushClip(const Rect& rect) override;
+                void PopClip() override;
+
+                // Render queue
+                void SetBatchLayer(int layer) override;
+
+                // Framebuffer readback (blank images of the current size)
+                bool QueueReadback() override;
+                bool CollectReadback(Image& image) override;
+
+                // Overlay effects
+                void DrawDiagonalLines(float x, float y, float width, float height, float lineSpacing = 10.0f, float lineWidth = 1.0f, Color color = Color(255, 255, 255, 10)) override;
+                void DrawRadialLines(float x, float y, float width, float height, float centerX1, float centerY1, float centerX2, float centerY2, int numLines = 20, float lineWidth = 1.0f, Color color = Color(255, 255, 255, 10)) override;
+                void DrawVerticalLines(float x, float y, float width, float height, float lineSpacing = 15.0f, float lineWidth = 1.0f, Color color = Color(255, 255, 255, 8)) override;
+                void DrawHorizontalLines(float x, float y, float width, float height, float lineSpacing = 15.0f, float lineWidth = 1.0f, Color color = Color(255, 255, 255, 8)) override;
+                void DrawFilmGrain(float x, float y, float width, float height, float intensity = 0.08f, int seed = 0) override;
+
+                // Primitive drawing
+                void DrawRect(float x, float y, float width, float height, Color color) override;
+                void DrawRectWithShadow(float x, float y, float width, float height, Color color, float shadowRadius, Color shadowColor, float shadowOffsetX = 0.0f, float shadowOffsetY = 0.0f) override;
+                void DrawShape(const Shape& shape) override;
+                void PaintText(const std::string& text, float x, float y, Color color) override;
+                void DrawGlyph(unsigned int texture, float x, float y, float width, float height, float u0, float v0, float u1, float v1, Color color, float rotation = 0.0f) override;
+                void DrawDistanceGlyph(unsigned int texture, float x, float y, float width, float height, float u0, float v0, float u1, float v1, Color color, float rotation = 0.0f) override;
+
+                // Recording (off by default, counting is always on)
+                void SetRecording(bool enabled) { recording = enabled; }
+                void SetHashing(bool enabled) { hashing = enabled; }
+                bool IsRecording() const { return recording; }
+                bool IsHashing() const { return hashing; }
+
+                const std::vector<Command>& GetCommands() const { return commands; }
+                uint64_t GetCallCount(Call call) const;
+                uint64_t GetTotalCalls() const;
+                uint64_t GetFrames() const { return frames; }
+
+                // FNV-1a over calls and arguments: whole stream and last presented frame
+                uint64_t GetStreamHash() const { return streamHash; }
+                uint64_t GetFrameHash() const { return frameHash; }
+
+                void Reset();
+                void PrintStatistics() const;
+                static const char* GetCallName(Call call);
+
+            private:
+                void Record(Call call, std::initializer_list<float> arguments, const Color* color = nullptr, const std::string* text = nullptr);
+                void Hash(const void* data, size_t size);
+                void Submit(const QuadCommand& command);
+                void FlushBatch();
+
+                static const uint64_t HASH_OFFSET = 14695981039346656037ULL;
+                static const uint64_t HASH_PRIME  = 1099511628211ULL;
+
+                int width;
+                int height;
+
+                bool recording  = false;
+                bool hashing    = false;
+
+                uint64_t counts[static_cast<int>(Call::COUNT)] = {};
+                uint64_t frames = 0;
+                std::vector<Command> commands;
+
+                uint64_t streamHash         = HASH_OFFSET;
+                uint64_t currentFrameHash   = HASH_OFFSET;
+                uint64_t frameHash          = HASH_OFFSET;
+
+                unsigned int nextHandle = 1;
+                const RenderTarget* boundTarget = nullptr;
+                std::vector<const RenderTarget*> offscreenStack;    // Bound target below each BeginOffscreen
+                bool scissorEnabled = false;
+                Rect scissorRect;
+
+                // Scissor state below each pushed clip
+                struct ClipState {
+                    bool enabled;
+                    Rect rect;
+                };
+
+                std::vector<ClipState> clipStack;
+                int pendingReadbacks = 0;
+
+                // Batches are sorted like on a real backend, for the queue statistics
+                RenderQueue queue;
+                int batchDepth = 0;
+            };
+        }
+    }
+}
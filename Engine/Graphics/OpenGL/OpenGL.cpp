@@ -1,7 +1,9 @@
 #include "Graphics/OpenGL/OpenGL.h"
 #include "Core/NativeWindow.h"
+#include "Graphics/RenderStats.h"
 #include <iostream>
 #include <cmath>
+#include <algorithm>
 
 #ifdef _WIN32
 #include <windows.h>
@@ -22,10 +24,126 @@ namespace Engine {
             // Initialize static function pointers
             OpenGL::PFNGLGENERATEMIPMAPPROC OpenGL::glGenerateMipmap_ptr = nullptr;
             OpenGL::PFNGLGENTEXTURESPROC OpenGL::glGenTextures_ptr = nullptr;
+            OpenGL::PFNGLGENFRAMEBUFFERSPROC OpenGL::glGenFramebuffers_ptr = nullptr;
+            OpenGL::PFNGLDELETEFRAMEBUFFERSPROC OpenGL::glDeleteFramebuffers_ptr = nullptr;
+            OpenGL::PFNGLBINDFRAMEBUFFERPROC OpenGL::glBindFramebuffer_ptr = nullptr;
+            OpenGL::PFNGLFRAMEBUFFERTEXTURE2DPROC OpenGL::glFramebufferTexture2D_ptr = nullptr;
+            OpenGL::PFNGLCHECKFRAMEBUFFERSTATUSPROC OpenGL::glCheckFramebufferStatus_ptr = nullptr;
+            OpenGL::PFNGLGENBUFFERSPROC OpenGL::glGenBuffers_ptr = nullptr;
+            OpenGL::PFNGLDELETEBUFFERSPROC OpenGL::glDeleteBuffers_ptr = nullptr;
+            OpenGL::PFNGLBINDBUFFERPROC OpenGL::glBindBuffer_ptr = nullptr;
+            OpenGL::PFNGLBUFFERDATAPROC OpenGL::glBufferData_ptr = nullptr;
+            OpenGL::PFNGLMAPBUFFERPROC OpenGL::glMapBuffer_ptr = nullptr;
+            OpenGL::PFNGLUNMAPBUFFERPROC OpenGL::glUnmapBuffer_ptr = nullptr;
+            OpenGL::PFNGLCREATESHADERPROC OpenGL::glCreateShader_ptr = nullptr;
+            OpenGL::PFNGLSHADERSOURCEPROC OpenGL::glShaderSource_ptr = nullptr;
+            OpenGL::PFNGLCOMPILESHADERPROC OpenGL::glCompileShader_ptr = nullptr;
+            OpenGL::PFNGLGETSHADERIVPROC OpenGL::glGetShaderiv_ptr = nullptr;
+            OpenGL::PFNGLGETSHADERINFOLOGPROC OpenGL::glGetShaderInfoLog_ptr = nullptr;
+            OpenGL::PFNGLDELETESHADERPROC OpenGL::glDeleteShader_ptr = nullptr;
+            OpenGL::PFNGLCREATEPROGRAMPROC OpenGL::glCreateProgram_ptr = nullptr;
+            OpenGL::PFNGLATTACHSHADERPROC OpenGL::glAttachShader_ptr = nullptr;
+            OpenGL::PFNGLLINKPROGRAMPROC OpenGL::glLinkProgram_ptr = nullptr;
+            OpenGL::PFNGLGETPROGRAMIVPROC OpenGL::glGetProgramiv_ptr = nullptr;
+            OpenGL::PFNGLUSEPROGRAMPROC OpenGL::glUseProgram_ptr = nullptr;
+            OpenGL::PFNGLGETUNIFORMLOCATIONPROC OpenGL::glGetUniformLocation_ptr = nullptr;
+            OpenGL::PFNGLUNIFORM1FPROC OpenGL::glUniform1f_ptr = nullptr;
+            OpenGL::PFNGLUNIFORM4FPROC OpenGL::glUniform4f_ptr = nullptr;
+            OpenGL::PFNGLBLENDFUNCSEPARATEPROC OpenGL::glBlendFuncSeparate_ptr = nullptr;
             #endif
 
+            bool OpenGL::framebufferSupported = false;
+            bool OpenGL::pixelBufferSupported = false;
+            unsigned int OpenGL::shapeProgram = 0;
+            int OpenGL::shapeUniforms[OpenGL::SHAPE_UNIFORMS] = {};
+            unsigned int OpenGL::distanceProgram = 0;
+
+            namespace {
+                // Pixel position is passed through, the fragment stage evaluates the signed distance
+                const char* SHAPE_VERTEX_SHADER =
+                    "#version 110\n"
+                    "void main() {\n"
+                    "    gl_TexCoord[0] = gl_Vertex;\n"
+                    "    gl_Position = ftransform();\n"
+                    "}\n";
+
+                // Same math as Shape::Evaluate (type: 0 rounded rect, 1 shadow, 2 ring)
+                const char* SHAPE_FRAGMENT_SHADER =
+                    "#version 110\n"
+                    "uniform float u_type;\n"
+                    "uniform vec4 u_rect;\n"              // center, half size
+                    "uniform vec4 u_params;\n"            // radius, border, softness, gradient type
+                    "uniform vec4 u_fill;\n"
+                    "uniform vec4 u_border;\n"
+                    "uniform vec4 u_gradientColor;\n"
+                    "uniform vec4 u_gradient;\n"          // start, end (radial: end.x is the radius)
+                    "void main() {\n"
+                    "    vec2 p = gl_TexCoord[0].xy;\n"
+                    "    vec2 halfSize = u_rect.zw;\n"
+                    "    float d;\n"
+                    "    if(u_type > 1.5) {\n"
+                    "        float thickness = max(u_params.y, 1.0);\n"
+                    "        d = abs(length(p - u_rect.xy) - (min(halfSize.x, halfSize.y) - thickness * 0.5)) - thickness * 0.5;\n"
+                    "    } else {\n"
+                    "        float corner = min(u_params.x, min(halfSize.x, halfSize.y));\n"
+                    "        vec2 q = abs(p - u_rect.xy) - halfSize + corner;\n"
+                    "        d = length(max(q, 0.0)) + min(max(q.x, q.y), 0.0) - corner;\n"
+                    "    }\n"
+                    "    vec4 color = u_fill;\n"
+                    "    if(u_params.w > 1.5) {\n"
+                    "        color = mix(u_fill, u_gradientColor, clamp(length(p - u_gradient.xy) / max(u_gradient.z, 0.0001), 0.0, 1.0));\n"
+                    "    } else if(u_params.w > 0.5) {\n"
+                    "        vec2 dir = u_gradient.zw - u_gradient.xy;\n"
+                    "        color = mix(u_fill, u_gradientColor, clamp(dot(p - u_gradient.xy, dir) / max(dot(dir, dir), 0.0001), 0.0, 1.0));\n"
+                    "    }\n"
+                    "    float coverage;\n"
+                    "    if(u_type > 0.5 && u_type < 1.5) {\n"
+                    "        float softness = max(u_params.z, 0.0001);\n"
+                    "        coverage = 1.0 - smoothstep(-softness, softness, d);\n"
+                    "    } else {\n"
+                    "        coverage = clamp(0.5 - d, 0.0, 1.0);\n"
+                    "        if(u_type < 0.5 && u_params.y > 0.0) {\n"
+                    "            color = mix(color, u_border, clamp(d + u_params.y + 0.5, 0.0, 1.0));\n"
+                    "        }\n"
+                    "    }\n"
+                    "    gl_FragColor = vec4(color.rgb, color.a * coverage);\n"
+                    "}\n";
+
+                const char* DISTANCE_VERTEX_SHADER =
+                    "#version 110\n"
+                    "void main() {\n"
+                    "    gl_TexCoord[0] = gl_MultiTexCoord0;\n"
+                    "    gl_FrontColor = gl_Color;\n"
+                    "    gl_Position = ftransform();\n"
+                    "}\n";
+
+                // Texture alpha is 0.5 on the outline; the ramp is kept about one screen pixel wide at any scale
+                const char* DISTANCE_FRAGMENT_SHADER =
+                    "#version 110\n"
+                    "uniform sampler2D u_glyphs;\n"
+                    "void main() {\n"
+                    "    float distance = texture2D(u_glyphs, gl_TexCoord[0].xy).a;\n"
+                    "    float width = max(fwidth(distance) * 0.7, 0.001);\n"
+                    "    float coverage = smoothstep(0.5 - width, 0.5 + width, distance);\n"
+                    "    gl_FragColor = vec4(gl_Color.rgb, gl_Color.a * coverage);\n"
+                    "}\n";
+            }
+
             OpenGL::~OpenGL() {
+                if(initialized) {
+                    for(auto& entry : shapeCache) {
+                        glDeleteTextures(1, &entry.second.id);
+                    }
+                }
 
+                if(initialized && pixelBufferSupported) {
+                    for(Readback& slot : readbacks) {
+                        if(slot.buffer != 0) {
+                            GLuint buffer = slot.buffer;
+                            OpenGL::glDeleteBuffers_ptr(1, &buffer);
+                        }
+                    }
+                }
             }
 
             bool OpenGL::Available() {
@@ -71,7 +189,19 @@ namespace Engine {
                 if (!wglMakeCurrent(hdc, hglrc)) return false;
 
                 // Version prüfen
-                version = reinterpret_cast<const char*>(glGetString(GL_VERSION));
+                const GLubyte* versionString = glGetString(GL_VERSION);
+                version = versionString ? reinterpret_cast<const char*>(versionString) : "";
+
+                // Extensions the backend makes use of
+                const GLubyte* extensionString = glGetString(GL_EXTENSIONS);
+                std::string extensions = extensionString ? reinterpret_cast<const char*>(extensionString) : "";
+                features.clear();
+
+                for(const char* extension : { "GL_ARB_framebuffer_object", "GL_EXT_framebuffer_object", "GL_ARB_pixel_buffer_object", "GL_ARB_texture_non_power_of_two", "GL_ARB_vertex_buffer_object" }) {
+                    if(extensions.find(extension) != std::string::npos) {
+                        features.push_back(extension);
+                    }
+                }
 
                 // Aufräumen
                 wglMakeCurrent(nullptr, nullptr);
@@ -87,11 +217,19 @@ namespace Engine {
                 return version;
             }
 
+            std::vector<std::string> OpenGL::GetFeatures() {
+                return features;
+            }
+
             void OpenGL::SetViewport(int width, int height) {
+                FlushBatch();
+
                 glViewport(0, 0, width, height);
             }
 
             void OpenGL::SetViewport(int x, int y, int width, int height) {
+                FlushBatch();
+
                 glViewport(x, y, width, height);
             }
 
@@ -130,6 +268,112 @@ namespace Engine {
                     throw std::runtime_error("Konnte OpenGL-Funktionen nicht laden!");
                 }
 
+                // Framebuffer objects (GL 3.0 / ARB_framebuffer_object)
+                OpenGL::glGenFramebuffers_ptr = reinterpret_cast<OpenGL::PFNGLGENFRAMEBUFFERSPROC>(
+                    reinterpret_cast<void*>(wglGetProcAddress("glGenFramebuffers"))
+                );
+                OpenGL::glDeleteFramebuffers_ptr = reinterpret_cast<OpenGL::PFNGLDELETEFRAMEBUFFERSPROC>(
+                    reinterpret_cast<void*>(wglGetProcAddress("glDeleteFramebuffers"))
+                );
+                OpenGL::glBindFramebuffer_ptr = reinterpret_cast<OpenGL::PFNGLBINDFRAMEBUFFERPROC>(
+                    reinterpret_cast<void*>(wglGetProcAddress("glBindFramebuffer"))
+                );
+                OpenGL::glFramebufferTexture2D_ptr = reinterpret_cast<OpenGL::PFNGLFRAMEBUFFERTEXTURE2DPROC>(
+                    reinterpret_cast<void*>(wglGetProcAddress("glFramebufferTexture2D"))
+                );
+                OpenGL::glCheckFramebufferStatus_ptr = reinterpret_cast<OpenGL::PFNGLCHECKFRAMEBUFFERSTATUSPROC>(
+                    reinterpret_cast<void*>(wglGetProcAddress("glCheckFramebufferStatus"))
+                );
+
+                framebufferSupported = OpenGL::glGenFramebuffers_ptr && OpenGL::glDeleteFramebuffers_ptr &&
+                    OpenGL::glBindFramebuffer_ptr && OpenGL::glFramebufferTexture2D_ptr && OpenGL::glCheckFramebufferStatus_ptr;
+
+                if(!framebufferSupported) {
+                    std::cout << "[OpenGL] Framebuffer objects not available, layers will render directly" << std::endl;
+                }
+
+                // Pixel buffer objects (GL 2.1 / ARB_pixel_buffer_object)
+                OpenGL::glGenBuffers_ptr = reinterpret_cast<OpenGL::PFNGLGENBUFFERSPROC>(
+                    reinterpret_cast<void*>(wglGetProcAddress("glGenBuffers"))
+                );
+                OpenGL::glDeleteBuffers_ptr = reinterpret_cast<OpenGL::PFNGLDELETEBUFFERSPROC>(
+                    reinterpret_cast<void*>(wglGetProcAddress("glDeleteBuffers"))
+                );
+                OpenGL::glBindBuffer_ptr = reinterpret_cast<OpenGL::PFNGLBINDBUFFERPROC>(
+                    reinterpret_cast<void*>(wglGetProcAddress("glBindBuffer"))
+                );
+                OpenGL::glBufferData_ptr = reinterpret_cast<OpenGL::PFNGLBUFFERDATAPROC>(
+                    reinterpret_cast<void*>(wglGetProcAddress("glBufferData"))
+                );
+                OpenGL::glMapBuffer_ptr = reinterpret_cast<OpenGL::PFNGLMAPBUFFERPROC>(
+                    reinterpret_cast<void*>(wglGetProcAddress("glMapBuffer"))
+                );
+                OpenGL::glUnmapBuffer_ptr = reinterpret_cast<OpenGL::PFNGLUNMAPBUFFERPROC>(
+                    reinterpret_cast<void*>(wglGetProcAddress("glUnmapBuffer"))
+                );
+
+                pixelBufferSupported = OpenGL::glGenBuffers_ptr && OpenGL::glDeleteBuffers_ptr && OpenGL::glBindBuffer_ptr &&
+                    OpenGL::glBufferData_ptr && OpenGL::glMapBuffer_ptr && OpenGL::glUnmapBuffer_ptr;
+
+                if(!pixelBufferSupported) {
+                    std::cout << "[OpenGL] Pixel buffer objects not available, readback will be synchronous" << std::endl;
+                }
+
+                // Shader objects (GL 2.0)
+                OpenGL::glCreateShader_ptr = reinterpret_cast<OpenGL::PFNGLCREATESHADERPROC>(
+                    reinterpret_cast<void*>(wglGetProcAddress("glCreateShader"))
+                );
+                OpenGL::glShaderSource_ptr = reinterpret_cast<OpenGL::PFNGLSHADERSOURCEPROC>(
+                    reinterpret_cast<void*>(wglGetProcAddress("glShaderSource"))
+                );
+                OpenGL::glCompileShader_ptr = reinterpret_cast<OpenGL::PFNGLCOMPILESHADERPROC>(
+                    reinterpret_cast<void*>(wglGetProcAddress("glCompileShader"))
+                );
+                OpenGL::glGetShaderiv_ptr = reinterpret_cast<OpenGL::PFNGLGETSHADERIVPROC>(
+                    reinterpret_cast<void*>(wglGetProcAddress("glGetShaderiv"))
+                );
+                OpenGL::glGetShaderInfoLog_ptr = reinterpret_cast<OpenGL::PFNGLGETSHADERINFOLOGPROC>(
+                    reinterpret_cast<void*>(wglGetProcAddress("glGetShaderInfoLog"))
+                );
+                OpenGL::glDeleteShader_ptr = reinterpret_cast<OpenGL::PFNGLDELETESHADERPROC>(
+                    reinterpret_cast<void*>(wglGetProcAddress("glDeleteShader"))
+                );
+                OpenGL::glCreateProgram_ptr = reinterpret_cast<OpenGL::PFNGLCREATEPROGRAMPROC>(
+                    reinterpret_cast<void*>(wglGetProcAddress("glCreateProgram"))
+                );
+                OpenGL::glAttachShader_ptr = reinterpret_cast<OpenGL::PFNGLATTACHSHADERPROC>(
+                    reinterpret_cast<void*>(wglGetProcAddress("glAttachShader"))
+                );
+                OpenGL::glLinkProgram_ptr = reinterpret_cast<OpenGL::PFNGLLINKPROGRAMPROC>(
+                    reinterpret_cast<void*>(wglGetProcAddress("glLinkProgram"))
+                );
+                OpenGL::glGetProgramiv_ptr = reinterpret_cast<OpenGL::PFNGLGETPROGRAMIVPROC>(
+                    reinterpret_cast<void*>(wglGetProcAddress("glGetProgramiv"))
+                );
+                OpenGL::glUseProgram_ptr = reinterpret_cast<OpenGL::PFNGLUSEPROGRAMPROC>(
+                    reinterpret_cast<void*>(wglGetProcAddress("glUseProgram"))
+                );
+                OpenGL::glGetUniformLocation_ptr = reinterpret_cast<OpenGL::PFNGLGETUNIFORMLOCATIONPROC>(
+                    reinterpret_cast<void*>(wglGetProcAddress("glGetUniformLocation"))
+                );
+                OpenGL::glUniform1f_ptr = reinterpret_cast<OpenGL::PFNGLUNIFORM1FPROC>(
+                    reinterpret_cast<void*>(wglGetProcAddress("glUniform1f"))
+                );
+                OpenGL::glUniform4f_ptr = reinterpret_cast<OpenGL::PFNGLUNIFORM4FPROC>(
+                    reinterpret_cast<void*>(wglGetProcAddress("glUniform4f"))
+                );
+                OpenGL::glBlendFuncSeparate_ptr = reinterpret_cast<OpenGL::PFNGLBLENDFUNCSEPARATEPROC>(
+                    reinterpret_cast<void*>(wglGetProcAddress("glBlendFuncSeparate"))
+                );
+
+                if(!CreateShapeProgram()) {
+                    std::cout << "[OpenGL] Shape shader not available, shapes will be rasterized on the CPU" << std::endl;
+                }
+
+                if(!CreateDistanceProgram()) {
+                    std::cout << "[OpenGL] Distance field shader not available, glyph edges will be alpha tested" << std::endl;
+                }
+
                 // Basic OpenGL setup - this was moved from NativeWindow::SetupRenderingContext
                 std::cout << "[OpenGL] Initializing OpenGL context" << std::endl;
 
@@ -183,25 +427,30 @@ namespace Engine {
 
             // Virtual method implementations
             void OpenGL::Clear() {
-                Clear(new RGBA(0, 0, 0, 100));
+                Clear(Color(0, 0, 0, 100));
             }
 
-            void OpenGL::Clear(IColor* color) {
+            void OpenGL::Clear(Color color) {
+                FlushBatch();
+
                 if(!initialized) {
                     std::cout << "[OpenGL] Clear called but OpenGL not initialized!" << std::endl;
                     return;
                 }
 
-                glClearColor(color->GetRed(), color->GetGreen(), color->GetBlue(), color->GetAlpha());
+                glClearColor(color.GetRed(), color.GetGreen(), color.GetBlue(), color.GetAlpha());
                 glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
             }
 
             void OpenGL::SwapBuffers() {
+                FlushBatch();
+
                 if(!initialized || !currentWindow) {
                     return;
                 }
 
                 currentWindow->SwapBuffers();
+                frameCounter++;
             }
 
             void OpenGL::Begin2D(int width, int height) {
@@ -209,6 +458,10 @@ namespace Engine {
                     return;
                 }
 
+                // Queued quads belong to the previous projection
+                FlushBatch();
+                batchDepth++;
+
                 // Set viewport to match the rendering dimensions
                 glViewport(0, 0, width, height);
 
@@ -220,6 +473,8 @@ namespace Engine {
                 glLoadIdentity();
 
                 glDisable(GL_DEPTH_TEST);
+
+                RenderStats::GetInstance().AddStateChange(2);
             }
 
             void OpenGL::End2D() {
@@ -227,19 +482,32 @@ namespace Engine {
                     return;
                 }
 
+                FlushBatch();
+                batchDepth = std::max(0, batchDepth - 1);
+
                 glEnable(GL_DEPTH_TEST);
+
+                RenderStats::GetInstance().AddStateChange();
             }
 
-            void OpenGL::DrawRect(float x, float y, float width, float height, IColor* color) {
+            void OpenGL::DrawRect(float x, float y, float width, float height, Color color) {
                 if(!initialized) {
                     return;
                 }
 
+                if(batchDepth > 0) {
+                    QuadCommand command;
+                    command.SetRect(x, y, width, height);
+                    command.SetColor(color);
+                    Submit(command);
+                    return;
+                }
+
                 // Enable blending for transparency
                 glEnable(GL_BLEND);
                 glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
-                glColor4f(color->GetRed(), color->GetGreen(), color->GetBlue(), color->GetAlpha());
+                glColor4f(color.GetRed(), color.GetGreen(), color.GetBlue(), color.GetAlpha());
 
                 glBegin(GL_QUADS);
                     glVertex2f(x, y);
@@ -250,9 +518,15 @@ namespace Engine {
 
                 // Restore blending state
                 glDisable(GL_BLEND);
+
+                RenderStats& stats = RenderStats::GetInstance();
+                stats.AddStateChange(3);
+                stats.AddDrawCall(4);
             }
 
-            void OpenGL::PaintText(const std::string& text, float x, float y, IColor* color) {
+            void OpenGL::PaintText(const std::string& text, float x, float y, Color color) {
+                FlushBatch();
+
                 (void) text;
                 (void) x;
                 (void) y;
@@ -267,9 +541,9 @@ namespace Engine {
                 glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
                 // Set text color
-                glColor3f(color->GetRed(), color->GetBlue(), color->GetGreen());
+                glColor3f(color.GetRed(), color.GetBlue(), color.GetGreen());
 
-                // @ToDo color->GetAlpha()
+                // @ToDo color.GetAlpha()
 
                 // Enable texturing
                 glEnable(GL_TEXTURE_2D);
@@ -277,6 +551,8 @@ namespace Engine {
                 // @ToDo Draw String
                 glDisable(GL_TEXTURE_2D);
                 glBindTexture(GL_TEXTURE_2D, 0);
+
+                RenderStats::GetInstance().AddStateChange(4);
             }
 
             Texture OpenGL::LoadTexture(const std::string& filename) {
@@ -307,14 +583,66 @@ namespace Engine {
                 // Speicher freigeben (OpenGL hat jetzt die Daten)
                 stbi_image_free(data);
 
+                RenderStats& stats = RenderStats::GetInstance();
+                stats.AddTextureBind();
+                stats.AddUpload(static_cast<uint64_t>(tex.width) * tex.height * 4);
+
                 return tex;
             }
 
+            Texture OpenGL::CreateTexture(const Image& image) {
+                FlushBatch();
+
+                Texture tex{};
+
+                if(!initialized || image.IsEmpty()) {
+                    return tex;
+                }
+
+                tex.width   = image.width;
+                tex.height  = image.height;
+
+                OpenGL::glGenTextures_ptr(1, &tex.id);
+                glBindTexture(GL_TEXTURE_2D, tex.id);
+                glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, tex.width, tex.height, 0, GL_RGBA, GL_UNSIGNED_BYTE, image.pixels.data());
+                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP);
+                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP);
+                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+                glBindTexture(GL_TEXTURE_2D, 0);
+
+                RenderStats& stats = RenderStats::GetInstance();
+                stats.AddTextureBind();
+                stats.AddUpload(static_cast<uint64_t>(tex.width) * tex.height * 4);
+
+                return tex;
+            }
+
+            void OpenGL::DestroyTexture(Texture& texture) {
+                FlushBatch();
+
+                if(initialized && texture.id != 0) {
+                    glDeleteTextures(1, &texture.id);
+                }
+
+                texture = Texture{};
+            }
+
             void OpenGL::DrawTexture(const Texture& texture, float x, float y, float width, float height) {
                 if(!initialized) {
                     return;
                 }
 
+                if(batchDepth > 0) {
+                    QuadCommand command;
+                    command.texture = texture.id;
+                    command.blend   = BlendMode::NONE;
+                    command.SetRect(x, y, width, height);
+                    command.SetTexCoords(0.0f, 0.0f, 1.0f, 1.0f);
+                    Submit(command);
+                    return;
+                }
+
                 glEnable(GL_TEXTURE_2D);
                 glBindTexture(GL_TEXTURE_2D, texture.id);
                 glColor3f(1.0f, 1.0f, 1.0f);
@@ -328,9 +656,16 @@ namespace Engine {
 
                 glBindTexture(GL_TEXTURE_2D, 0);
                 glDisable(GL_TEXTURE_2D);
+
+                RenderStats& stats = RenderStats::GetInstance();
+                stats.AddStateChange(2);
+                stats.AddTextureBind();
+                stats.AddDrawCall(4);
             }
 
             void OpenGL::DrawTextureBlurred(const Texture& texture, float x, float y, float width, float height, float blurRadius) {
+                FlushBatch();
+
                 if(!initialized) {
                     return;
                 }
@@ -395,20 +730,389 @@ namespace Engine {
                 glBindTexture(GL_TEXTURE_2D, 0);
                 glDisable(GL_BLEND);
                 glDisable(GL_TEXTURE_2D);
+
+                RenderStats& stats = RenderStats::GetInstance();
+                stats.AddStateChange(5);
+                stats.AddTextureBind();
+
+                // Main image plus four shifted copies per pass
+                for(int draw = 0; draw < 1 + std::max(0, maxPasses) * 4; draw++) {
+                    stats.AddDrawCall(4);
+                }
+            }
+
+            RenderTarget OpenGL::CreateRenderTarget(int width, int height) {
+                FlushBatch();
+
+                RenderTarget target{};
+
+                if(!initialized || !framebufferSupported || width <= 0 || height <= 0) {
+                    return target;
+                }
+
+                target.width            = width;
+                target.height           = height;
+                target.texture.width    = width;
+                target.texture.height   = height;
+
+                OpenGL::glGenTextures_ptr(1, &target.texture.id);
+                glBindTexture(GL_TEXTURE_2D, target.texture.id);
+                glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+                RenderStats::GetInstance().AddTextureBind();
+                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP);
+                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP);
+                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+                glBindTexture(GL_TEXTURE_2D, 0);
+
+                GLuint framebuffer = 0;
+                OpenGL::glGenFramebuffers_ptr(1, &framebuffer);
+                OpenGL::glBindFramebuffer_ptr(GL_FRAMEBUFFER, framebuffer);
+                OpenGL::glFramebufferTexture2D_ptr(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, target.texture.id, 0);
+
+                GLenum status = OpenGL::glCheckFramebufferStatus_ptr(GL_FRAMEBUFFER);
+                OpenGL::glBindFramebuffer_ptr(GL_FRAMEBUFFER, 0);
+
+                if(status != GL_FRAMEBUFFER_COMPLETE) {
+                    std::cout << "[OpenGL] Framebuffer incomplete (" << status << ")" << std::endl;
+                    OpenGL::glDeleteFramebuffers_ptr(1, &framebuffer);
+                    glDeleteTextures(1, &target.texture.id);
+                    return RenderTarget{};
+                }
+
+                target.framebuffer = framebuffer;
+                return target;
             }
 
-            void OpenGL::DrawDiagonalLines(float x, float y, float width, float height, float lineSpacing, float lineWidth, IColor* color) {
+            void OpenGL::DestroyRenderTarget(RenderTarget& target) {
+                FlushBatch();
+
+                if(!initialized || !target.IsValid()) {
+                    return;
+                }
+
+                GLuint framebuffer = target.framebuffer;
+                OpenGL::glDeleteFramebuffers_ptr(1, &framebuffer);
+                glDeleteTextures(1, &target.texture.id);
+
+                target = RenderTarget{};
+            }
+
+            void OpenGL::BindRenderTarget(const RenderTarget* target) {
+                FlushBatch();
+
+                if(!initialized || !framebufferSupported) {
+                    return;
+                }
+
+                if(target && target->IsValid()) {
+                    OpenGL::glBindFramebuffer_ptr(GL_FRAMEBUFFER, target->framebuffer);
+                    glViewport(0, 0, target->width, target->height);
+                    boundTarget = target;
+                } else {
+                    OpenGL::glBindFramebuffer_ptr(GL_FRAMEBUFFER, 0);
+                    glViewport(0, 0, GetWidth(), GetHeight());
+                    boundTarget = nullptr;
+                }
+
+                RenderStats::GetInstance().AddStateChange();
+
+                // Scissor box is stored in framebuffer pixels, re-apply for the new height
+                if(scissorEnabled) {
+                    SetScissor(&scissorRect);
+                }
+            }
+
+            const RenderTarget* OpenGL::GetRenderTarget() {
+                return boundTarget;
+            }
+
+            void OpenGL::SetScissor(const Rect* rect) {
+                FlushBatch();
+
+                if(!initialized) {
+                    return;
+                }
+
+                RenderStats::GetInstance().AddStateChange();
+
+                if(!rect) {
+                    scissorEnabled = false;
+                    glDisable(GL_SCISSOR_TEST);
+                    return;
+                }
+
+                scissorEnabled  = true;
+                scissorRect     = *rect;
+
+                int surfaceHeight = boundTarget ? boundTarget->height : GetHeight();
+                int left    = static_cast<int>(std::floor(rect->x));
+                int top     = static_cast<int>(std::floor(rect->y));
+                int right   = static_cast<int>(std::ceil(rect->GetRight()));
+                int bottom  = static_cast<int>(std::ceil(rect->GetBottom()));
+
+                // GL scissor origin is bottom-left
+                glEnable(GL_SCISSOR_TEST);
+                glScissor(left, surfaceHeight - bottom, std::max(0, right - left), std::max(0, bottom - top));
+            }
+
+            bool OpenGL::GetScissor(Rect& rect) {
+                if(scissorEnabled) {
+                    rect = scissorRect;
+                }
+
+                return scissorEnabled;
+            }
+
+            void OpenGL::PushClip(const Rect& rect) {
+                // Disjoint clips leave an empty rect, which hides everything
+                Rect clip = scissorEnabled ? scissorRect.Intersection(rect) : rect;
+
+                clipStack.push_back({ scissorEnabled, scissorRect });
+                SetScissor(&clip);
+            }
+
+            void OpenGL::PopClip() {
+                if(clipStack.empty()) {
+                    return;
+                }
+
+                ClipState previous = clipStack.back();
+                clipStack.pop_back();
+
+                SetScissor(previous.enabled ? &previous.rect : nullptr);
+            }
+
+            void OpenGL::BeginOffscreen(const RenderTarget& target) {
+                FlushBatch();
+
+                if(!initialized) {
+                    return;
+                }
+
+                OffscreenState state;
+                state.target        = boundTarget;
+                state.clip.enabled  = scissorEnabled;
+                state.clip.rect     = scissorRect;
+                glGetIntegerv(GL_VIEWPORT, state.viewport);
+                offscreenStack.push_back(state);
+
+                SetScissor(nullptr);
+                BindRenderTarget(&target);
+
+                glMatrixMode(GL_PROJECTION);
+                glPushMatrix();
+                glLoadIdentity();
+                glOrtho(0, target.width, target.height, 0, -1, 1);
+
+                glMatrixMode(GL_MODELVIEW);
+                glPushMatrix();
+                glLoadIdentity();
+
+                // Quads queued inside go to the target, FlushBatch in EndOffscreen draws them there
+                batchDepth++;
+
+                RenderStats::GetInstance().AddStateChange(2);
+            }
+
+            void OpenGL::EndOffscreen() {
+                if(!initialized || offscreenStack.empty()) {
+                    return;
+                }
+
+                FlushBatch();
+                batchDepth = std::max(0, batchDepth - 1);
+
+                glMatrixMode(GL_PROJECTION);
+                glPopMatrix();
+                glMatrixMode(GL_MODELVIEW);
+                glPopMatrix();
+
+                OffscreenState state = offscreenStack.back();
+                offscreenStack.pop_back();
+
+                BindRenderTarget(state.target);
+                glViewport(state.viewport[0], state.viewport[1], state.viewport[2], state.viewport[3]);
+                SetScissor(state.clip.enabled ? &state.clip.rect : nullptr);
+
+                RenderStats::GetInstance().AddStateChange(3);
+            }
+
+            void OpenGL::DrawPremultiplied(const RenderTarget& target, float x, float y, float width, float height) {
+                if(!initialized || !target.IsValid()) {
+                    return;
+                }
+
+                // Texture rows are bottom-up, V is flipped
+                QuadCommand command;
+                command.texture = target.texture.id;
+                command.blend   = BlendMode::PREMULTIPLIED;
+                command.SetRect(x, y, width, height);
+                command.SetTexCoords(0.0f, 1.0f, 1.0f, 0.0f);
+
+                DrawGlyphQuad(command);
+            }
+
+            void OpenGL::DrawRenderTarget(const RenderTarget& target, float x, float y, float width, float height) {
+                FlushBatch();
+
+                if(!initialized || !target.IsValid()) {
+                    return;
+                }
+
+                // Layers are composited opaque; texture rows are bottom-up, so V is flipped
+                glDisable(GL_BLEND);
+                glEnable(GL_TEXTURE_2D);
+                glBindTexture(GL_TEXTURE_2D, target.texture.id);
+                glColor4f(1.0f, 1.0f, 1.0f, 1.0f);
+
+                glBegin(GL_QUADS);
+                    glTexCoord2f(0.0f, 1.0f); glVertex2f(x, y);
+                    glTexCoord2f(1.0f, 1.0f); glVertex2f(x + width, y);
+                    glTexCoord2f(1.0f, 0.0f); glVertex2f(x + width, y + height);
+                    glTexCoord2f(0.0f, 0.0f); glVertex2f(x, y + height);
+                glEnd();
+
+                glBindTexture(GL_TEXTURE_2D, 0);
+                glDisable(GL_TEXTURE_2D);
+
+                RenderStats& stats = RenderStats::GetInstance();
+                stats.AddStateChange(3);
+                stats.AddTextureBind();
+                stats.AddDrawCall(4);
+            }
+
+            bool OpenGL::QueueReadback() {
+                FlushBatch();
+
+                if(!initialized) {
+                    return false;
+                }
+
+                int width   = GetWidth();
+                int height  = GetHeight();
+
+                if(width <= 0 || height <= 0) {
+                    return false;
+                }
+
+                glPixelStorei(GL_PACK_ALIGNMENT, 4);
+
+                // No PBOs: read synchronously, the image is ready on the next collect
+                if(!pixelBufferSupported) {
+                    Image raw;
+                    raw.width   = width;
+                    raw.height  = height;
+                    raw.pixels.resize(raw.GetStride() * height);
+                    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, raw.pixels.data());
+
+                    Image image;
+                    image.width     = width;
+                    image.height    = height;
+                    image.pixels.resize(raw.pixels.size());
+
+                    for(int row = 0; row < height; row++) {
+                        std::copy_n(raw.pixels.data() + (height - 1 - row) * raw.GetStride(), raw.GetStride(), image.pixels.data() + row * image.GetStride());
+                    }
+
+                    finishedReadbacks.push_back(std::move(image));
+                    return true;
+                }
+
+                Readback& slot = readbacks[readbackWrite];
+
+                // Ring full: the caller drops this frame
+                if(slot.pending) {
+                    return false;
+                }
+
+                if(slot.buffer == 0) {
+                    GLuint buffer = 0;
+                    OpenGL::glGenBuffers_ptr(1, &buffer);
+                    slot.buffer = buffer;
+                }
+
+                OpenGL::glBindBuffer_ptr(GL_PIXEL_PACK_BUFFER, slot.buffer);
+
+                if(slot.width != width || slot.height != height) {
+                    OpenGL::glBufferData_ptr(GL_PIXEL_PACK_BUFFER, static_cast<GLsizeiptr>(width) * height * 4, nullptr, GL_STREAM_READ);
+                    slot.width  = width;
+                    slot.height = height;
+                }
+
+                // Returns immediately, the copy runs on the GPU
+                glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+                OpenGL::glBindBuffer_ptr(GL_PIXEL_PACK_BUFFER, 0);
+
+                slot.pending    = true;
+                slot.frame      = frameCounter;
+                readbackWrite   = (readbackWrite + 1) % READBACK_SLOTS;
+
+                return true;
+            }
+
+            bool OpenGL::CollectReadback(Image& image) {
+                if(!finishedReadbacks.empty()) {
+                    image = std::move(finishedReadbacks.front());
+                    finishedReadbacks.pop_front();
+                    return true;
+                }
+
+                if(!initialized || !pixelBufferSupported) {
+                    return false;
+                }
+
+                Readback& slot = readbacks[readbackRead];
+
+                // Mapping before the GPU finished would stall the frame
+                if(!slot.pending || frameCounter - slot.frame < 2) {
+                    return false;
+                }
+
+                image.width     = slot.width;
+                image.height    = slot.height;
+                image.pixels.clear();
+
+                OpenGL::glBindBuffer_ptr(GL_PIXEL_PACK_BUFFER, slot.buffer);
+                const uint8_t* data = static_cast<const uint8_t*>(OpenGL::glMapBuffer_ptr(GL_PIXEL_PACK_BUFFER, GL_READ_ONLY));
+
+                if(data) {
+                    image.pixels.resize(image.GetStride() * image.height);
+
+                    // GL rows are bottom-up
+                    for(int row = 0; row < image.height; row++) {
+                        std::copy_n(data + (image.height - 1 - row) * image.GetStride(), image.GetStride(), image.pixels.data() + row * image.GetStride());
+                    }
+
+                    OpenGL::glUnmapBuffer_ptr(GL_PIXEL_PACK_BUFFER);
+                } else {
+                    std::cout << "[OpenGL] Readback could not be mapped" << std::endl;
+                }
+
+                OpenGL::glBindBuffer_ptr(GL_PIXEL_PACK_BUFFER, 0);
+
+                slot.pending    = false;
+                readbackRead    = (readbackRead + 1) % READBACK_SLOTS;
+
+                // Consumed even if mapping failed, keeps the FIFO in order
+                return true;
+            }
+
+            void OpenGL::DrawDiagonalLines(float x, float y, float width, float height, float lineSpacing, float lineWidth, Color color) {
+                FlushBatch();
+
                 if(!initialized) {
                     return;
                 }
 
                 glEnable(GL_BLEND);
                 glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-                glColor4f(color->GetRed(), color->GetGreen(), color->GetBlue(), color->GetAlpha());
+                glColor4f(color.GetRed(), color.GetGreen(), color.GetBlue(), color.GetAlpha());
 
                 // Draw diagonal lines from top-left to bottom-right
                 glLineWidth(lineWidth);
                 glBegin(GL_LINES);
+                uint64_t vertices = 0;
 
                 // Calculate the diagonal distance to cover entire area
                 //float maxDistance = width + height;
@@ -473,23 +1177,31 @@ namespace Engine {
                     // Draw the line
                     glVertex2f(startX, startY);
                     glVertex2f(endX, endY);
+                    vertices += 2;
                 }
 
                 glEnd();
                 glDisable(GL_BLEND);
+
+                RenderStats& stats = RenderStats::GetInstance();
+                stats.AddStateChange(4);
+                stats.AddDrawCall(vertices);
             }
 
-            void OpenGL::DrawRadialLines(float x, float y, float width, float height, float centerX1, float centerY1, float centerX2, float centerY2, int numLines, float lineWidth, IColor* color) {
+            void OpenGL::DrawRadialLines(float x, float y, float width, float height, float centerX1, float centerY1, float centerX2, float centerY2, int numLines, float lineWidth, Color color) {
+                FlushBatch();
+
                 if(!initialized) {
                     return;
                 }
 
                 glEnable(GL_BLEND);
                 glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-                glColor4f(color->GetRed(), color->GetGreen(), color->GetBlue(), color->GetAlpha());
+                glColor4f(color.GetRed(), color.GetGreen(), color.GetBlue(), color.GetAlpha());
                 glLineWidth(lineWidth);
 
                 glBegin(GL_LINES);
+                uint64_t vertices = 0;
 
                 // Draw radial lines from first center point
                 for(int i = 0; i < numLines; i++) {
@@ -510,6 +1222,7 @@ namespace Engine {
                        (clippedEndX >= x && clippedEndX <= x + width && clippedEndY >= y && clippedEndY <= y + height)) {
                         glVertex2f(clippedStartX, clippedStartY);
                         glVertex2f(clippedEndX, clippedEndY);
+                        vertices += 2;
                     }
                 }
 
@@ -532,47 +1245,63 @@ namespace Engine {
                        (clippedEndX >= x && clippedEndX <= x + width && clippedEndY >= y && clippedEndY <= y + height)) {
                         glVertex2f(clippedStartX, clippedStartY);
                         glVertex2f(clippedEndX, clippedEndY);
+                        vertices += 2;
                     }
                 }
 
                 glEnd();
                 glDisable(GL_BLEND);
+
+                RenderStats& stats = RenderStats::GetInstance();
+                stats.AddStateChange(4);
+                stats.AddDrawCall(vertices);
             }
 
-            void OpenGL::DrawVerticalLines(float x, float y, float width, float height, float lineSpacing, float lineWidth, IColor* color) {
+            void OpenGL::DrawVerticalLines(float x, float y, float width, float height, float lineSpacing, float lineWidth, Color color) {
+                FlushBatch();
+
                 if(!initialized) {
                     return;
                 }
 
                 glEnable(GL_BLEND);
                 glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-                glColor4f(color->GetRed(), color->GetGreen(), color->GetBlue(), color->GetAlpha());
+                glColor4f(color.GetRed(), color.GetGreen(), color.GetBlue(), color.GetAlpha());
                 glLineWidth(lineWidth);
 
                 glBegin(GL_LINES);
+                uint64_t vertices = 0;
 
                 // Draw simple vertical lines across the screen
                 for(float lineX = x; lineX <= x + width; lineX += lineSpacing) {
                     glVertex2f(lineX, y);
                     glVertex2f(lineX, y + height);
+                    vertices += 2;
                 }
 
                 glEnd();
                 glDisable(GL_BLEND);
+
+                RenderStats& stats = RenderStats::GetInstance();
+                stats.AddStateChange(4);
+                stats.AddDrawCall(vertices);
             }
 
-            void OpenGL::DrawHorizontalLines(float x, float y, float width, float height, float lineSpacing, float lineWidth, IColor* color) {
+            void OpenGL::DrawHorizontalLines(float x, float y, float width, float height, float lineSpacing, float lineWidth, Color color) {
+                FlushBatch();
+
                 if(!initialized) {
                     return;
                 }
 
                 glEnable(GL_BLEND);
                 glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-                glColor4f(color->GetRed(), color->GetGreen(), color->GetBlue(), color->GetAlpha());
+                glColor4f(color.GetRed(), color.GetGreen(), color.GetBlue(), color.GetAlpha());
                 glLineWidth(lineWidth);
 
                 // Use GL_QUADS for thicker, more visible lines
                 glBegin(GL_QUADS);
+                uint64_t vertices = 0;
 
                 // Draw simple horizontal lines across the screen
                 // lineSpacing should be the total distance between line starts
@@ -583,12 +1312,19 @@ namespace Engine {
                     glVertex2f(x + width, lineY);
                     glVertex2f(x + width, lineY + lineWidth);
                     glVertex2f(x, lineY + lineWidth);
+                    vertices += 4;
                 }
                 glEnd();
                 glDisable(GL_BLEND);
+
+                RenderStats& stats = RenderStats::GetInstance();
+                stats.AddStateChange(4);
+                stats.AddDrawCall(vertices);
             }
 
             void OpenGL::DrawFilmGrain(float x, float y, float width, float height, float intensity, int seed) {
+                FlushBatch();
+
                 if(!initialized) {
                     return;
                 }
@@ -664,6 +1400,11 @@ namespace Engine {
 
                 glEnd();
                 glDisable(GL_BLEND);
+
+                RenderStats& stats = RenderStats::GetInstance();
+                stats.AddStateChange(6);
+                stats.AddDrawCall(static_cast<uint64_t>(std::max(0, grainDensity)));
+                stats.AddDrawCall(static_cast<uint64_t>(std::max(0, largerGrainCount)) * 4);
             }
 
             // Helper function for clamping
@@ -685,8 +1426,479 @@ namespace Engine {
                 outA = defaultA + (borderA - defaultA) * clampedScale;
             }
             
-            void OpenGL::DrawRectWithShadow(float x, float y, float width, float height, IColor* color, 
-                                           float shadowRadius, IColor* shadowColor, float shadowOffsetX, float shadowOffsetY) {
+            void OpenGL::DrawGlyph(unsigned int texture, float x, float y, float width, float height, float u0, float v0, float u1, float v1, Color color, float rotation) {
+                if(!initialized) {
+                    return;
+                }
+
+                QuadCommand command;
+                command.texture = texture;
+                command.SetRect(x, y, width, height);
+                command.SetTexCoords(u0, v0, u1, v1);
+                command.SetColor(color);
+                command.Rotate(rotation);
+
+                DrawGlyphQuad(command);
+            }
+
+            void OpenGL::DrawDistanceGlyph(unsigned int texture, float x, float y, float width, float height, float u0, float v0, float u1, float v1, Color color, float rotation) {
+                if(!initialized) {
+                    return;
+                }
+
+                QuadCommand command;
+                command.texture = texture;
+                command.blend   = BlendMode::DISTANCE;
+                command.SetRect(x, y, width, height);
+                command.SetTexCoords(u0, v0, u1, v1);
+                command.SetColor(color);
+                command.Rotate(rotation);
+
+                DrawGlyphQuad(command);
+            }
+
+            void OpenGL::DrawGlyphQuad(const QuadCommand& command) {
+                if(batchDepth > 0) {
+                    Submit(command);
+                    return;
+                }
+
+                glEnable(GL_BLEND);
+                SetBlendFunc(command.blend);
+                glEnable(GL_TEXTURE_2D);
+                glBindTexture(GL_TEXTURE_2D, command.texture);
+
+                if(command.blend == BlendMode::DISTANCE) {
+                    BeginDistanceField();
+                }
+
+                glBegin(GL_QUADS);
+                    EmitQuad(command);
+                glEnd();
+
+                if(command.blend == BlendMode::DISTANCE) {
+                    EndDistanceField();
+                }
+
+                glBindTexture(GL_TEXTURE_2D, 0);
+                glDisable(GL_TEXTURE_2D);
+                glDisable(GL_BLEND);
+
+                RenderStats& stats = RenderStats::GetInstance();
+                stats.AddStateChange(4);
+                stats.AddTextureBind();
+                stats.AddDrawCall(4);
+            }
+
+            void OpenGL::BeginDistanceField() {
+                RenderStats& stats = RenderStats::GetInstance();
+
+                #ifdef _WIN32
+                if(distanceProgram) {
+                    glUseProgram_ptr(distanceProgram);
+                    stats.AddStateChange();
+                    return;
+                }
+                #endif
+
+                // Hard edge without the shader: still sharp when scaled, but aliased (and faded glyphs thin out)
+                glEnable(GL_ALPHA_TEST);
+                glAlphaFunc(GL_GREATER, 0.5f);
+                stats.AddStateChange(2);
+            }
+
+            void OpenGL::EndDistanceField() {
+                #ifdef _WIN32
+                if(distanceProgram) {
+                    glUseProgram_ptr(0);
+                    RenderStats::GetInstance().AddStateChange();
+                    return;
+                }
+                #endif
+
+                glDisable(GL_ALPHA_TEST);
+                RenderStats::GetInstance().AddStateChange();
+            }
+
+            void OpenGL::SetBlendFunc(BlendMode blend) {
+                if(blend == BlendMode::PREMULTIPLIED) {
+                    glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+                    return;
+                }
+
+                #ifdef _WIN32
+                // Coverage accumulates in alpha instead of being squared, so offscreen targets end up premultiplied
+                if(glBlendFuncSeparate_ptr) {
+                    glBlendFuncSeparate_ptr(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+                    return;
+                }
+                #endif
+
+                glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+            }
+
+            void OpenGL::SetBatchLayer(int layer) {
+                queue.SetLayer(layer);
+            }
+
+            void OpenGL::Submit(const QuadCommand& command) {
+                // Quads outside the clip would be discarded by the scissor test anyway
+                if(scissorEnabled && !scissorRect.Intersects(command.GetBounds())) {
+                    RenderStats::GetInstance().AddCulled();
+                    return;
+                }
+
+                if(!queue.Submit(command)) {
+                    FlushBatch();
+                    queue.Submit(command);
+                }
+            }
+
+            void OpenGL::FlushBatch() {
+                if(queue.IsEmpty()) {
+                    return;
+                }
+
+                const std::vector<uint32_t>& order = queue.Sort();
+                RenderStats& stats = RenderStats::GetInstance();
+
+                // One glBegin/glEnd per run of equal blend mode and texture
+                bool open           = false;
+                int blend           = -1;
+                unsigned int bound  = 0;
+                bool textured       = false;
+                uint64_t vertices   = 0;
+
+                for(uint32_t index : order) {
+                    const QuadCommand& command = queue.Get(index);
+
+                    if(!open || static_cast<int>(command.blend) != blend || command.texture != bound) {
+                        if(open) {
+                            glEnd();
+                            stats.AddDrawCall(vertices);
+                            vertices = 0;
+                        }
+
+                        if(static_cast<int>(command.blend) != blend) {
+                            if(blend == static_cast<int>(BlendMode::DISTANCE)) {
+                                EndDistanceField();
+                            }
+
+                            if(command.blend != BlendMode::NONE) {
+                                glEnable(GL_BLEND);
+                                SetBlendFunc(command.blend);
+                                stats.AddStateChange(2);
+                            } else {
+                                glDisable(GL_BLEND);
+                                stats.AddStateChange();
+                            }
+
+                            if(command.blend == BlendMode::DISTANCE) {
+                                BeginDistanceField();
+                            }
+
+                            blend = static_cast<int>(command.blend);
+                        }
+
+                        if(!open || command.texture != bound) {
+                            if(command.texture != 0) {
+                                if(!textured) {
+                                    glEnable(GL_TEXTURE_2D);
+                                    stats.AddStateChange();
+                                    textured = true;
+                                }
+
+                                glBindTexture(GL_TEXTURE_2D, command.texture);
+                                stats.AddTextureBind();
+                            } else if(textured) {
+                                glDisable(GL_TEXTURE_2D);
+                                stats.AddStateChange();
+                                textured = false;
+                            }
+
+                            bound = command.texture;
+                        }
+
+                        glBegin(GL_QUADS);
+                        open = true;
+                    }
+
+                    EmitQuad(command);
+                    vertices += 4;
+                }
+
+                if(open) {
+                    glEnd();
+                    stats.AddDrawCall(vertices);
+                }
+
+                if(blend == static_cast<int>(BlendMode::DISTANCE)) {
+                    EndDistanceField();
+                }
+
+                if(textured) {
+                    glBindTexture(GL_TEXTURE_2D, 0);
+                    glDisable(GL_TEXTURE_2D);
+                }
+
+                glDisable(GL_BLEND);
+                stats.AddStateChange(2);
+
+                queue.Clear();
+            }
+
+            void OpenGL::EmitQuad(const QuadCommand& command) {
+                glColor4f(command.color[0], command.color[1], command.color[2], command.color[3]);
+
+                for(int corner = 0; corner < 4; corner++) {
+                    glTexCoord2f(command.texCoords[corner * 2], command.texCoords[corner * 2 + 1]);
+                    glVertex2f(command.positions[corner * 2], command.positions[corner * 2 + 1]);
+                }
+            }
+
+            unsigned int OpenGL::LinkProgram(const char* vertexSource, const char* fragmentSource, const char* name) {
+                #ifdef _WIN32
+                if(!glCreateShader_ptr || !glShaderSource_ptr || !glCompileShader_ptr || !glGetShaderiv_ptr ||
+                   !glGetShaderInfoLog_ptr || !glDeleteShader_ptr || !glCreateProgram_ptr || !glAttachShader_ptr ||
+                   !glLinkProgram_ptr || !glGetProgramiv_ptr || !glUseProgram_ptr) {
+                    return 0;
+                }
+
+                const char* sources[2]  = { vertexSource, fragmentSource };
+                const GLenum types[2]   = { GL_VERTEX_SHADER, GL_FRAGMENT_SHADER };
+                GLuint shaders[2]       = { 0, 0 };
+
+                for(int index = 0; index < 2; index++) {
+                    shaders[index] = glCreateShader_ptr(types[index]);
+                    glShaderSource_ptr(shaders[index], 1, &sources[index], nullptr);
+                    glCompileShader_ptr(shaders[index]);
+
+                    GLint compiled = GL_FALSE;
+                    glGetShaderiv_ptr(shaders[index], GL_COMPILE_STATUS, &compiled);
+
+                    if(compiled != GL_TRUE) {
+                        char log[512] = {};
+                        glGetShaderInfoLog_ptr(shaders[index], sizeof(log), nullptr, log);
+                        std::cout << "[OpenGL] " << name << " shader failed to compile: " << log << std::endl;
+
+                        for(GLuint shader : shaders) {
+                            if(shader) {
+                                glDeleteShader_ptr(shader);
+                            }
+                        }
+
+                        return 0;
+                    }
+                }
+
+                GLuint program = glCreateProgram_ptr();
+                glAttachShader_ptr(program, shaders[0]);
+                glAttachShader_ptr(program, shaders[1]);
+                glLinkProgram_ptr(program);
+
+                // Flagged for deletion, freed together with the program
+                glDeleteShader_ptr(shaders[0]);
+                glDeleteShader_ptr(shaders[1]);
+
+                GLint linked = GL_FALSE;
+                glGetProgramiv_ptr(program, GL_LINK_STATUS, &linked);
+
+                if(linked != GL_TRUE) {
+                    std::cout << "[OpenGL] " << name << " shader failed to link" << std::endl;
+                    return 0;
+                }
+
+                std::cout << "[OpenGL] " << name << " shader ready" << std::endl;
+                return program;
+                #else
+                (void) vertexSource;
+                (void) fragmentSource;
+                (void) name;
+                return 0;
+                #endif
+            }
+
+            bool OpenGL::CreateShapeProgram() {
+                #ifdef _WIN32
+                if(!glGetUniformLocation_ptr || !glUniform1f_ptr || !glUniform4f_ptr) {
+                    return false;
+                }
+
+                GLuint program = LinkProgram(SHAPE_VERTEX_SHADER, SHAPE_FRAGMENT_SHADER, "Shape");
+
+                if(!program) {
+                    return false;
+                }
+
+                const char* names[SHAPE_UNIFORMS] = {
+                    "u_type", "u_rect", "u_params", "u_fill", "u_border", "u_gradientColor", "u_gradient"
+                };
+
+                for(int index = 0; index < SHAPE_UNIFORMS; index++) {
+                    shapeUniforms[index] = glGetUniformLocation_ptr(program, names[index]);
+                }
+
+                shapeProgram = program;
+                return true;
+                #else
+                return false;
+                #endif
+            }
+
+            bool OpenGL::CreateDistanceProgram() {
+                // The sampler stays on texture unit 0, no uniforms to set
+                distanceProgram = LinkProgram(DISTANCE_VERTEX_SHADER, DISTANCE_FRAGMENT_SHADER, "Distance field");
+                return distanceProgram != 0;
+            }
+
+            void OpenGL::DrawShape(const Shape& shape) {
+                FlushBatch();
+
+                if(!initialized) {
+                    return;
+                }
+
+                Rect area = shape.GetCoverage();
+
+                if(scissorEnabled && !scissorRect.Intersects(area)) {
+                    RenderStats::GetInstance().AddCulled();
+                    return;
+                }
+
+                if(!shapeProgram) {
+                    DrawShapeRasterized(shape);
+                    return;
+                }
+
+                #ifdef _WIN32
+                glEnable(GL_BLEND);
+                SetBlendFunc(BlendMode::ALPHA);
+                glUseProgram_ptr(shapeProgram);
+
+                float halfWidth     = shape.bounds.width * 0.5f;
+                float halfHeight    = shape.bounds.height * 0.5f;
+
+                glUniform1f_ptr(shapeUniforms[SHAPE_TYPE], static_cast<float>(shape.type));
+                glUniform4f_ptr(shapeUniforms[SHAPE_RECT], shape.bounds.x + halfWidth, shape.bounds.y + halfHeight, halfWidth, halfHeight);
+                glUniform4f_ptr(shapeUniforms[SHAPE_PARAMS], shape.radius, shape.borderWidth, shape.softness, static_cast<float>(shape.gradient));
+                glUniform4f_ptr(shapeUniforms[SHAPE_FILL], shape.fill[0], shape.fill[1], shape.fill[2], shape.fill[3]);
+                glUniform4f_ptr(shapeUniforms[SHAPE_BORDER], shape.border[0], shape.border[1], shape.border[2], shape.border[3]);
+                glUniform4f_ptr(shapeUniforms[SHAPE_GRADIENT_COLOR], shape.gradientColor[0], shape.gradientColor[1], shape.gradientColor[2], shape.gradientColor[3]);
+                glUniform4f_ptr(shapeUniforms[SHAPE_GRADIENT], shape.gradientStart[0], shape.gradientStart[1], shape.gradientEnd[0], shape.gradientEnd[1]);
+
+                // One quad over everything the shape can touch, the fragment stage does the rest
+                glBegin(GL_QUADS);
+                    glVertex2f(area.x, area.y);
+                    glVertex2f(area.x + area.width, area.y);
+                    glVertex2f(area.x + area.width, area.y + area.height);
+                    glVertex2f(area.x, area.y + area.height);
+                glEnd();
+
+                glUseProgram_ptr(0);
+                glDisable(GL_BLEND);
+
+                RenderStats& stats = RenderStats::GetInstance();
+                stats.AddStateChange(4);
+                stats.AddDrawCall(4);
+                #endif
+            }
+
+            void OpenGL::DrawShapeRasterized(const Shape& shape) {
+                Rect coverage   = shape.GetCoverage();
+                float left      = std::floor(coverage.x);
+                float top       = std::floor(coverage.y);
+                int width       = static_cast<int>(std::ceil(coverage.x + coverage.width) - left);
+                int height      = static_cast<int>(std::ceil(coverage.y + coverage.height) - top);
+
+                if(width <= 0 || height <= 0) {
+                    return;
+                }
+
+                // Same shape at another whole pixel position reuses the texture
+                Shape local = shape;
+                local.bounds.x          -= left;
+                local.bounds.y          -= top;
+                local.gradientStart[0]  -= left;
+                local.gradientStart[1]  -= top;
+
+                if(local.gradient == GradientType::LINEAR) {
+                    local.gradientEnd[0] -= left;
+                    local.gradientEnd[1] -= top;
+                }
+
+                // Fading shapes (blinking, fades) share one texture: the strongest alpha is taken out and
+                // applied through the tint, the shaded alpha is linear in the colors' alphas
+                float alpha = std::max(local.fill[3], std::max(local.border[3], local.gradient != GradientType::NONE ? local.gradientColor[3] : 0.0f));
+
+                if(alpha <= 0.0f) {
+                    return;
+                }
+
+                local.fill[3]           /= alpha;
+                local.border[3]         /= alpha;
+                local.gradientColor[3]  /= alpha;
+
+                const float values[] = {
+                    static_cast<float>(local.type), local.bounds.x, local.bounds.y, local.bounds.width, local.bounds.height,
+                    local.radius, local.borderWidth, local.softness,
+                    local.fill[0], local.fill[1], local.fill[2], local.fill[3],
+                    local.border[0], local.border[1], local.border[2], local.border[3],
+                    static_cast<float>(local.gradient),
+                    local.gradientColor[0], local.gradientColor[1], local.gradientColor[2], local.gradientColor[3],
+                    local.gradientStart[0], local.gradientStart[1], local.gradientEnd[0], local.gradientEnd[1]
+                };
+
+                uint64_t key = 14695981039346656037ULL;
+                const unsigned char* bytes = reinterpret_cast<const unsigned char*>(values);
+
+                for(size_t index = 0; index < sizeof(values); index++) {
+                    key = (key ^ bytes[index]) * 1099511628211ULL;
+                }
+
+                auto cached = shapeCache.find(key);
+
+                if(cached == shapeCache.end()) {
+                    if(shapeCache.size() >= SHAPE_CACHE_SIZE) {
+                        for(auto& entry : shapeCache) {
+                            glDeleteTextures(1, &entry.second.id);
+                        }
+
+                        shapeCache.clear();
+                    }
+
+                    std::vector<uint8_t> pixels(static_cast<size_t>(width) * height * 4);
+
+                    for(int row = 0; row < height; row++) {
+                        local.EvaluateRow(0.0f, static_cast<float>(row), width, &pixels[static_cast<size_t>(row) * width * 4]);
+                    }
+
+                    Texture texture{};
+                    texture.width   = width;
+                    texture.height  = height;
+
+                    OpenGL::glGenTextures_ptr(1, &texture.id);
+                    glBindTexture(GL_TEXTURE_2D, texture.id);
+                    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+                    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP);
+                    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP);
+                    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+                    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+                    glBindTexture(GL_TEXTURE_2D, 0);
+
+                    RenderStats& stats = RenderStats::GetInstance();
+                    stats.AddTextureBind();
+                    stats.AddUpload(static_cast<uint64_t>(width) * height * 4);
+
+                    cached = shapeCache.emplace(key, texture).first;
+                }
+
+                DrawGlyph(cached->second.id, left, top, static_cast<float>(width), static_cast<float>(height), 0.0f, 0.0f, 1.0f, 1.0f, Color::FromFloats(1.0f, 1.0f, 1.0f, alpha));
+            }
+
+            void OpenGL::DrawRectWithShadow(float x, float y, float width, float height, Color color, 
+                                           float shadowRadius, Color shadowColor, float shadowOffsetX, float shadowOffsetY) {
+                FlushBatch();
+
                 if(!initialized) {
                     std::cout << "[OpenGL] DrawRectWithShadow called but OpenGL not initialized!" << std::endl;
                     return;
@@ -713,14 +1925,15 @@ namespace Engine {
                     
                     // Optimized approach: Draw 4 shadow strips around the box with gradients
                     glBegin(GL_QUADS);
+                    uint64_t vertices = 0;
                     
                     // Left shadow strip (only middle part, not corners)
                     for (int i = 0; i < (int)shadowRadius; i++) {
                         float distance = (float)(i + 1);
-                        float alpha = shadowColor->GetAlpha() * (1.0f - (distance / shadowRadius)) * 0.5f;
+                        float alpha = shadowColor.GetAlpha() * (1.0f - (distance / shadowRadius)) * 0.5f;
                         if (alpha <= 0.01f) break;
                         
-                        glColor4f(shadowColor->GetRed(), shadowColor->GetGreen(), shadowColor->GetBlue(), alpha);
+                        glColor4f(shadowColor.GetRed(), shadowColor.GetGreen(), shadowColor.GetBlue(), alpha);
                         float x1 = shadowX - distance;
                         float x2 = shadowX - distance + 1.0f;
                         
@@ -729,15 +1942,16 @@ namespace Engine {
                         glVertex2f(x2, shadowY);
                         glVertex2f(x2, shadowY + height);
                         glVertex2f(x1, shadowY + height);
+                        vertices += 4;
                     }
                     
                     // Right shadow strip (only middle part, not corners)
                     for (int i = 0; i < (int)shadowRadius; i++) {
                         float distance = (float)(i + 1);
-                        float alpha = shadowColor->GetAlpha() * (1.0f - (distance / shadowRadius)) * 0.5f;
+                        float alpha = shadowColor.GetAlpha() * (1.0f - (distance / shadowRadius)) * 0.5f;
                         if (alpha <= 0.01f) break;
                         
-                        glColor4f(shadowColor->GetRed(), shadowColor->GetGreen(), shadowColor->GetBlue(), alpha);
+                        glColor4f(shadowColor.GetRed(), shadowColor.GetGreen(), shadowColor.GetBlue(), alpha);
                         float x1 = shadowX + width + distance - 1.0f;
                         float x2 = shadowX + width + distance;
                         
@@ -745,15 +1959,16 @@ namespace Engine {
                         glVertex2f(x2, shadowY);
                         glVertex2f(x2, shadowY + height);
                         glVertex2f(x1, shadowY + height);
+                        vertices += 4;
                     }
                     
                     // Top shadow strip (only middle part, not corners)
                     for (int i = 0; i < (int)shadowRadius; i++) {
                         float distance = (float)(i + 1);
-                        float alpha = shadowColor->GetAlpha() * (1.0f - (distance / shadowRadius)) * 0.5f;
+                        float alpha = shadowColor.GetAlpha() * (1.0f - (distance / shadowRadius)) * 0.5f;
                         if (alpha <= 0.01f) break;
                         
-                        glColor4f(shadowColor->GetRed(), shadowColor->GetGreen(), shadowColor->GetBlue(), alpha);
+                        glColor4f(shadowColor.GetRed(), shadowColor.GetGreen(), shadowColor.GetBlue(), alpha);
                         float y1 = shadowY - distance;
                         float y2 = shadowY - distance + 1.0f;
                         
@@ -762,15 +1977,16 @@ namespace Engine {
                         glVertex2f(shadowX + width, y1);
                         glVertex2f(shadowX + width, y2);
                         glVertex2f(shadowX, y2);
+                        vertices += 4;
                     }
                     
                     // Bottom shadow strip (only middle part, not corners)
                     for (int i = 0; i < (int)shadowRadius; i++) {
                         float distance = (float)(i + 1);
-                        float alpha = shadowColor->GetAlpha() * (1.0f - (distance / shadowRadius)) * 0.5f;
+                        float alpha = shadowColor.GetAlpha() * (1.0f - (distance / shadowRadius)) * 0.5f;
                         if (alpha <= 0.01f) break;
                         
-                        glColor4f(shadowColor->GetRed(), shadowColor->GetGreen(), shadowColor->GetBlue(), alpha);
+                        glColor4f(shadowColor.GetRed(), shadowColor.GetGreen(), shadowColor.GetBlue(), alpha);
                         float y1 = shadowY + height + distance - 1.0f;
                         float y2 = shadowY + height + distance;
                         
@@ -779,6 +1995,7 @@ namespace Engine {
                         glVertex2f(shadowX + width, y1);
                         glVertex2f(shadowX + width, y2);
                         glVertex2f(shadowX, y2);
+                        vertices += 4;
                     }
                     
                     // Fill corner areas with proper gradients - extend to connect with strips
@@ -796,10 +2013,11 @@ namespace Engine {
                             if (cornerDist > shadowRadius) continue;
                             
                             // Use radial distance but reduce alpha slightly to match strips better
-                            float alpha = shadowColor->GetAlpha() * (1.0f - (cornerDist / shadowRadius)) * 0.4f;
+                            float alpha = shadowColor.GetAlpha() * (1.0f - (cornerDist / shadowRadius)) * 0.4f;
                             if (alpha <= 0.01f) continue;
                             
-                            glColor4f(shadowColor->GetRed(), shadowColor->GetGreen(), shadowColor->GetBlue(), alpha);
+                            glColor4f(shadowColor.GetRed(), shadowColor.GetGreen(), shadowColor.GetBlue(), alpha);
+                            vertices += 16;
                             
                             // Top-left corner - extend to meet strips
                             if (x > 0 || y > 0) { // Don't draw the center point
@@ -837,6 +2055,10 @@ namespace Engine {
                     
                     glEnd();
                     glDisable(GL_BLEND);
+
+                    RenderStats& stats = RenderStats::GetInstance();
+                    stats.AddStateChange(3);
+                    stats.AddDrawCall(vertices);
                 }
                 
                 // Draw the main rectangle on top
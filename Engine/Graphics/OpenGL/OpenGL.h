@@ -1,8 +1,12 @@
 #pragma once
 
 #include "../IRenderingAPI.h"
+#include "../RenderQueue.h"
 #include <string>
 #include <memory>
+#include <deque>
+#include <vector>
+#include <unordered_map>
 
 #ifdef _WIN32
     #include <windows.h>
@@ -26,6 +30,7 @@ namespace Engine {
                 // Implementations for the pure virtual functions
                 bool Available() override;
                 std::string GetVersion() override;
+                std::vector<std::string> GetFeatures() override;
                 void CreateDevice() override;
                 void GetDevice() override;
                 void CreateContext() override;
@@ -38,7 +43,7 @@ namespace Engine {
 
                 // Rendering operations
                 void Clear() override;
-                void Clear(IColor* color = new RGBA(0, 0, 0, 100)) override;
+                void Clear(Color color = Color(0, 0, 0, 100)) override;
                 void SwapBuffers() override;
 
                 // 2D rendering setup
@@ -46,22 +51,50 @@ namespace Engine {
                 void End2D() override;
 
                 Texture LoadTexture(const std::string& path) override;
+                Texture CreateTexture(const Image& image) override;
+                void DestroyTexture(Texture& texture) override;
 
                 // Texture drawing
                 void DrawTexture(const Texture& texture, float x, float y, float width, float height) override;
                 void DrawTextureBlurred(const Texture& texture, float x, float y, float width, float height, float blurRadius = 2.0f) override;
 
+                // Offscreen rendering
+                RenderTarget CreateRenderTarget(int width, int height) override;
+                void DestroyRenderTarget(RenderTarget& target) override;
+                void BindRenderTarget(const RenderTarget* target) override;
+                void DrawRenderTarget(const RenderTarget& target, float x, float y, float width, float height) override;
+                const RenderTarget* GetRenderTarget() override;
+                void BeginOffscreen(const RenderTarget& target) override;
+                void EndOffscreen() override;
+                void DrawPremultiplied(const RenderTarget& target, float x, float y, float width, float height) override;
+
+                // Scissor
+                void SetScissor(const Rect* rect) override;
+                bool GetScissor(Rect& rect) override;
+                void PushClip(const Rect& rect) override;
+                void PopClip() override;
+
+                // Render queue
+                void SetBatchLayer(int layer) override;
+
+                // Framebuffer readback
+                bool QueueReadback() override;
+                bool CollectReadback(Image& image) override;
+
                 // Overlay effects
-                void DrawDiagonalLines(float x, float y, float width, float height, float lineSpacing = 10.0f, float lineWidth = 1.0f, IColor* color = new RGBA(255, 255, 255, 10)) override;
-                void DrawRadialLines(float x, float y, float width, float height, float centerX1, float centerY1, float centerX2, float centerY2, int numLines = 20, float lineWidth = 1.0f, IColor* color = new RGBA(255, 255, 255, 10)) override;
-                void DrawVerticalLines(float x, float y, float width, float height, float lineSpacing = 15.0f, float lineWidth = 1.0f, IColor* color = new RGBA(255, 255, 255, 8)) override;
-                void DrawHorizontalLines(float x, float y, float width, float height, float lineSpacing = 15.0f, float lineWidth = 1.0f, IColor* color = new RGBA(255, 255, 255, 8)) override;
+                void DrawDiagonalLines(float x, float y, float width, float height, float lineSpacing = 10.0f, float lineWidth = 1.0f, Color color = Color(255, 255, 255, 10)) override;
+                void DrawRadialLines(float x, float y, float width, float height, float centerX1, float centerY1, float centerX2, float centerY2, int numLines = 20, float lineWidth = 1.0f, Color color = Color(255, 255, 255, 10)) override;
+                void DrawVerticalLines(float x, float y, float width, float height, float lineSpacing = 15.0f, float lineWidth = 1.0f, Color color = Color(255, 255, 255, 8)) override;
+                void DrawHorizontalLines(float x, float y, float width, float height, float lineSpacing = 15.0f, float lineWidth = 1.0f, Color color = Color(255, 255, 255, 8)) override;
                 void DrawFilmGrain(float x, float y, float width, float height, float intensity = 0.08f, int seed = 0) override;
 
                 // Primitive drawing
-                void DrawRect(float x, float y, float width, float height, IColor* color) override;
-                void DrawRectWithShadow(float x, float y, float width, float height, IColor* color, float shadowRadius, IColor* shadowColor, float shadowOffsetX = 0.0f, float shadowOffsetY = 0.0f) override;
-                void PaintText(const std::string& text, float x, float y, IColor* color) override;
+                void DrawRect(float x, float y, float width, float height, Color color) override;
+                void DrawRectWithShadow(float x, float y, float width, float height, Color color, float shadowRadius, Color shadowColor, float shadowOffsetX = 0.0f, float shadowOffsetY = 0.0f) override;
+                void DrawShape(const Shape& shape) override;
+                void PaintText(const std::string& text, float x, float y, Color color) override;
+                void DrawGlyph(unsigned int texture, float x, float y, float width, float height, float u0, float v0, float u1, float v1, Color color, float rotation = 0.0f) override;
+                void DrawDistanceGlyph(unsigned int texture, float x, float y, float width, float height, float u0, float v0, float u1, float v1, Color color, float rotation = 0.0f) override;
 
                 // Static methods for backwards compatibility
                 static void Shutdown();
@@ -74,6 +107,42 @@ namespace Engine {
                 static std::shared_ptr<NativeWindow> currentWindow;
                 static bool initialized;
                 std::string version;
+                std::vector<std::string> features;
+
+                // Render queue, active between Begin2D and End2D (nested for layers)
+                RenderQueue queue;
+                int batchDepth = 0;
+
+                void Submit(const QuadCommand& command);
+                void FlushBatch();
+                static void EmitQuad(const QuadCommand& command);
+
+                // Queues the glyph inside a batch, draws it right away outside
+                void DrawGlyphQuad(const QuadCommand& command);
+                static void BeginDistanceField();
+                static void EndDistanceField();
+                static void SetBlendFunc(BlendMode blend);
+
+                const RenderTarget* boundTarget = nullptr;
+                bool scissorEnabled = false;
+                Rect scissorRect;
+
+                // Scissor state below each pushed clip
+                struct ClipState {
+                    bool enabled;
+                    Rect rect;
+                };
+
+                std::vector<ClipState> clipStack;
+
+                // State below each BeginOffscreen
+                struct OffscreenState {
+                    const RenderTarget* target;
+                    ClipState clip;
+                    int viewport[4];
+                };
+
+                std::vector<OffscreenState> offscreenStack;
                 
                 #ifdef _WIN32
                 // OpenGL function pointers (moved from global scope)
@@ -82,7 +151,135 @@ namespace Engine {
                 
                 typedef void (APIENTRYP PFNGLGENTEXTURESPROC)(GLsizei n, GLuint* textures);
                 static PFNGLGENTEXTURESPROC glGenTextures_ptr;
+
+                // Framebuffer objects (optional, layers fall back to direct rendering)
+                typedef void (APIENTRYP PFNGLGENFRAMEBUFFERSPROC)(GLsizei n, GLuint* framebuffers);
+                static PFNGLGENFRAMEBUFFERSPROC glGenFramebuffers_ptr;
+
+                typedef void (APIENTRYP PFNGLDELETEFRAMEBUFFERSPROC)(GLsizei n, const GLuint* framebuffers);
+                static PFNGLDELETEFRAMEBUFFERSPROC glDeleteFramebuffers_ptr;
+
+                typedef void (APIENTRYP PFNGLBINDFRAMEBUFFERPROC)(GLenum target, GLuint framebuffer);
+                static PFNGLBINDFRAMEBUFFERPROC glBindFramebuffer_ptr;
+
+                typedef void (APIENTRYP PFNGLFRAMEBUFFERTEXTURE2DPROC)(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level);
+                static PFNGLFRAMEBUFFERTEXTURE2DPROC glFramebufferTexture2D_ptr;
+
+                typedef GLenum (APIENTRYP PFNGLCHECKFRAMEBUFFERSTATUSPROC)(GLenum target);
+                static PFNGLCHECKFRAMEBUFFERSTATUSPROC glCheckFramebufferStatus_ptr;
+
+                // Pixel buffer objects for asynchronous readback
+                typedef void (APIENTRYP PFNGLGENBUFFERSPROC)(GLsizei n, GLuint* buffers);
+                static PFNGLGENBUFFERSPROC glGenBuffers_ptr;
+
+                typedef void (APIENTRYP PFNGLDELETEBUFFERSPROC)(GLsizei n, const GLuint* buffers);
+                static PFNGLDELETEBUFFERSPROC glDeleteBuffers_ptr;
+
+                typedef void (APIENTRYP PFNGLBINDBUFFERPROC)(GLenum target, GLuint buffer);
+                static PFNGLBINDBUFFERPROC glBindBuffer_ptr;
+
+                typedef void (APIENTRYP PFNGLBUFFERDATAPROC)(GLenum target, GLsizeiptr size, const void* data, GLenum usage);
+                static PFNGLBUFFERDATAPROC glBufferData_ptr;
+
+                typedef void* (APIENTRYP PFNGLMAPBUFFERPROC)(GLenum target, GLenum access);
+                static PFNGLMAPBUFFERPROC glMapBuffer_ptr;
+
+                typedef GLboolean (APIENTRYP PFNGLUNMAPBUFFERPROC)(GLenum target);
+                static PFNGLUNMAPBUFFERPROC glUnmapBuffer_ptr;
+
+                // Shader objects for analytic shapes (GL 2.0)
+                typedef GLuint (APIENTRYP PFNGLCREATESHADERPROC)(GLenum type);
+                static PFNGLCREATESHADERPROC glCreateShader_ptr;
+
+                typedef void (APIENTRYP PFNGLSHADERSOURCEPROC)(GLuint shader, GLsizei count, const GLchar* const* string, const GLint* length);
+                static PFNGLSHADERSOURCEPROC glShaderSource_ptr;
+
+                typedef void (APIENTRYP PFNGLCOMPILESHADERPROC)(GLuint shader);
+                static PFNGLCOMPILESHADERPROC glCompileShader_ptr;
+
+                typedef void (APIENTRYP PFNGLGETSHADERIVPROC)(GLuint shader, GLenum pname, GLint* params);
+                static PFNGLGETSHADERIVPROC glGetShaderiv_ptr;
+
+                typedef void (APIENTRYP PFNGLGETSHADERINFOLOGPROC)(GLuint shader, GLsizei bufSize, GLsizei* length, GLchar* infoLog);
+                static PFNGLGETSHADERINFOLOGPROC glGetShaderInfoLog_ptr;
+
+                typedef void (APIENTRYP PFNGLDELETESHADERPROC)(GLuint shader);
+                static PFNGLDELETESHADERPROC glDeleteShader_ptr;
+
+                typedef GLuint (APIENTRYP PFNGLCREATEPROGRAMPROC)(void);
+                static PFNGLCREATEPROGRAMPROC glCreateProgram_ptr;
+
+                typedef void (APIENTRYP PFNGLATTACHSHADERPROC)(GLuint program, GLuint shader);
+                static PFNGLATTACHSHADERPROC glAttachShader_ptr;
+
+                typedef void (APIENTRYP PFNGLLINKPROGRAMPROC)(GLuint program);
+                static PFNGLLINKPROGRAMPROC glLinkProgram_ptr;
+
+                typedef void (APIENTRYP PFNGLGETPROGRAMIVPROC)(GLuint program, GLenum pname, GLint* params);
+                static PFNGLGETPROGRAMIVPROC glGetProgramiv_ptr;
+
+                typedef void (APIENTRYP PFNGLUSEPROGRAMPROC)(GLuint program);
+                static PFNGLUSEPROGRAMPROC glUseProgram_ptr;
+
+                typedef GLint (APIENTRYP PFNGLGETUNIFORMLOCATIONPROC)(GLuint program, const GLchar* name);
+                static PFNGLGETUNIFORMLOCATIONPROC glGetUniformLocation_ptr;
+
+                typedef void (APIENTRYP PFNGLUNIFORM1FPROC)(GLint location, GLfloat v0);
+                static PFNGLUNIFORM1FPROC glUniform1f_ptr;
+
+                typedef void (APIENTRYP PFNGLUNIFORM4FPROC)(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3);
+                static PFNGLUNIFORM4FPROC glUniform4f_ptr;
+
+                // Separate alpha factors (GL 1.4), keeps alpha right when blending into a transparent target
+                typedef void (APIENTRYP PFNGLBLENDFUNCSEPARATEPROC)(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha);
+                static PFNGLBLENDFUNCSEPARATEPROC glBlendFuncSeparate_ptr;
                 #endif
+
+                static bool framebufferSupported;
+                static bool pixelBufferSupported;
+
+                // Signed distance program for DrawShape, CPU rasterized textures without it
+                enum ShapeUniform {
+                    SHAPE_TYPE,
+                    SHAPE_RECT,
+                    SHAPE_PARAMS,
+                    SHAPE_FILL,
+                    SHAPE_BORDER,
+                    SHAPE_GRADIENT_COLOR,
+                    SHAPE_GRADIENT,
+                    SHAPE_UNIFORMS
+                };
+
+                static unsigned int shapeProgram;
+                static int shapeUniforms[SHAPE_UNIFORMS];
+                static bool CreateShapeProgram();
+
+                // Edge threshold for BlendMode::DISTANCE glyphs, alpha test without it
+                static unsigned int distanceProgram;
+                static bool CreateDistanceProgram();
+
+                // Compiles and links a vertex and fragment shader, 0 on failure
+                static unsigned int LinkProgram(const char* vertexSource, const char* fragmentSource, const char* name);
+
+                static const size_t SHAPE_CACHE_SIZE = 64;
+                std::unordered_map<uint64_t, Texture> shapeCache;
+                void DrawShapeRasterized(const Shape& shape);
+
+                // Readback ring, mapped two frames after the read was issued
+                struct Readback {
+                    unsigned int buffer = 0;
+                    int width           = 0;
+                    int height          = 0;
+                    unsigned int frame  = 0;
+                    bool pending        = false;
+                };
+
+                static const int READBACK_SLOTS = 3;
+                Readback readbacks[READBACK_SLOTS];
+                int readbackWrite = 0;
+                int readbackRead = 0;
+                unsigned int frameCounter = 0;
+                std::deque<Image> finishedReadbacks;
             };
         }
     }
@@ -0,0 +1,383 @@
+#include "PostProcess.h"
+#include "../Core/Engine.h"
+#include "../Core/FrameArena.h"
+#include <iostream>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <cmath>
+#include <cstring>
+#include <cstdint>
+
+namespace Engine {
+    namespace Graphics {
+        namespace {
+            float Clamp01(float value) {
+                return std::max(0.0f, std::min(value, 1.0f));
+            }
+
+            uint8_t ToByte(float value) {
+                return static_cast<uint8_t>(Clamp01(value) * 255.0f + 0.5f);
+            }
+
+            // Bilinear resample of rows [top, bottom) into target
+            void Resample(const Image& source, Image& target, int top, int bottom) {
+                size_t stride = target.GetStride();
+
+                if(source.width == target.width && source.height == target.height) {
+                    std::memcpy(&target.pixels[top * stride], &source.pixels[top * stride], (bottom - top) * stride);
+                    return;
+                }
+
+                float scaleX = static_cast<float>(source.width) / target.width;
+                float scaleY = static_cast<float>(source.height) / target.height;
+                size_t sourceStride = source.GetStride();
+
+                for(int y = top; y < bottom; y++) {
+                    float sy    = std::max(0.0f, (y + 0.5f) * scaleY - 0.5f);
+                    int y0      = std::min(static_cast<int>(sy), source.height - 1);
+                    int y1      = std::min(y0 + 1, source.height - 1);
+                    float fy    = sy - y0;
+
+                    const uint8_t* row0 = &source.pixels[y0 * sourceStride];
+                    const uint8_t* row1 = &source.pixels[y1 * sourceStride];
+                    uint8_t* out        = &target.pixels[y * stride];
+
+                    for(int x = 0; x < target.width; x++) {
+                        float sx    = std::max(0.0f, (x + 0.5f) * scaleX - 0.5f);
+                        int x0      = std::min(static_cast<int>(sx), source.width - 1);
+                        int x1      = std::min(x0 + 1, source.width - 1);
+                        float fx    = sx - x0;
+
+                        for(int channel = 0; channel < 4; channel++) {
+                            float upper     = row0[x0 * 4 + channel] + (row0[x1 * 4 + channel] - row0[x0 * 4 + channel]) * fx;
+                            float lower     = row1[x0 * 4 + channel] + (row1[x1 * 4 + channel] - row1[x0 * 4 + channel]) * fx;
+                            out[x * 4 + channel] = static_cast<uint8_t>(upper + (lower - upper) * fy + 0.5f);
+                        }
+                    }
+                }
+            }
+
+            // Runs a group of pointwise passes over rows [top, bottom) with one load and store per pixel
+            void ShadeRows(const std::vector<const PostPass*>& group, Image& image, int top, int bottom) {
+                if(group.empty()) {
+                    return;
+                }
+
+                for(int y = top; y < bottom; y++) {
+                    uint8_t* pixel = &image.pixels[y * image.GetStride()];
+
+                    for(int x = 0; x < image.width; x++, pixel += 4) {
+                        float rgb[3] = { pixel[0] / 255.0f, pixel[1] / 255.0f, pixel[2] / 255.0f };
+
+                        for(const PostPass* pass : group) {
+                            pass->Shade(x, y, rgb);
+                        }
+
+                        pixel[0] = ToByte(rgb[0]);
+                        pixel[1] = ToByte(rgb[1]);
+                        pixel[2] = ToByte(rgb[2]);
+                    }
+                }
+            }
+        }
+
+        void PostPass::Prepare(int width, int height) {
+            (void) width;
+            (void) height;
+        }
+
+        void PostPass::Shade(int x, int y, float* rgb) const {
+            (void) x;
+            (void) y;
+            (void) rgb;
+        }
+
+        void PostPass::Process(int sweep, const Image& source, Image& target, int top, int bottom) const {
+            (void) sweep;
+            size_t stride = source.GetStride();
+            std::memcpy(&target.pixels[top * stride], &source.pixels[top * stride], (bottom - top) * stride);
+        }
+
+        void BlurPass::Process(int sweep, const Image& source, Image& target, int top, int bottom) const {
+            int width       = source.width;
+            int height      = source.height;
+            size_t stride   = source.GetStride();
+            int window      = radius * 2 + 1;
+
+            if(radius <= 0) {
+                PostPass::Process(sweep, source, target, top, bottom);
+                return;
+            }
+
+            if(sweep == 0) {
+                // Horizontal: running sum along each row, edges clamped
+                for(int y = top; y < bottom; y++) {
+                    const uint8_t* in   = &source.pixels[y * stride];
+                    uint8_t* out        = &target.pixels[y * stride];
+                    uint32_t sum[4]     = {};
+
+                    for(int offset = -radius; offset <= radius; offset++) {
+                        int x = std::max(0, std::min(offset, width - 1));
+
+                        for(int channel = 0; channel < 4; channel++) {
+                            sum[channel] += in[x * 4 + channel];
+                        }
+                    }
+
+                    for(int x = 0; x < width; x++) {
+                        int add     = std::min(x + radius + 1, width - 1);
+                        int remove  = std::max(x - radius, 0);
+
+                        for(int channel = 0; channel < 4; channel++) {
+                            out[x * 4 + channel] = static_cast<uint8_t>(sum[channel] / window);
+                            sum[channel] += in[add * 4 + channel];
+                            sum[channel] -= in[remove * 4 + channel];
+                        }
+                    }
+                }
+
+                return;
+            }
+
+            // Vertical: whole rows are accumulated so memory is read in order
+            FrameVector<uint32_t> sum(stride, &FrameArena::Get());
+
+            for(int y = top; y < bottom; y++) {
+                std::fill(sum.begin(), sum.end(), 0);
+
+                for(int offset = -radius; offset <= radius; offset++) {
+                    const uint8_t* in = &source.pixels[std::max(0, std::min(y + offset, height - 1)) * stride];
+
+                    for(size_t index = 0; index < stride; index++) {
+                        sum[index] += in[index];
+                    }
+                }
+
+                uint8_t* out = &target.pixels[y * stride];
+
+                for(size_t index = 0; index < stride; index++) {
+                    out[index] = static_cast<uint8_t>(sum[index] / window);
+                }
+            }
+        }
+
+        ScanlinePass::ScanlinePass(float lineSpacing, float lineWidth, Color value) :
+            period(std::max(lineSpacing + lineWidth, 1.0f)), lineWidth(lineWidth) {
+            color[0] = value.GetRed();
+            color[1] = value.GetGreen();
+            color[2] = value.GetBlue();
+            color[3] = value.GetAlpha();
+        }
+
+        void ScanlinePass::Shade(int x, int y, float* rgb) const {
+            (void) x;
+
+            if(std::fmod(static_cast<float>(y), period) >= lineWidth) {
+                return;
+            }
+
+            for(int channel = 0; channel < 3; channel++) {
+                rgb[channel] += (color[channel] - rgb[channel]) * color[3];
+            }
+        }
+
+        void VignettePass::Prepare(int width, int height) {
+            centerX         = width * 0.5f;
+            centerY         = height * 0.5f;
+            inverseExtent   = 1.0f / std::max(std::sqrt(centerX * centerX + centerY * centerY), 1.0f);
+        }
+
+        void VignettePass::Shade(int x, int y, float* rgb) const {
+            float dx        = (x + 0.5f - centerX) * inverseExtent;
+            float dy        = (y + 0.5f - centerY) * inverseExtent;
+            float t         = Clamp01((std::sqrt(dx * dx + dy * dy) - radius) / std::max(1.0f - radius, 0.0001f));
+            float factor    = 1.0f - strength * t * t * (3.0f - 2.0f * t);
+
+            rgb[0] *= factor;
+            rgb[1] *= factor;
+            rgb[2] *= factor;
+        }
+
+        void GrainPass::Shade(int x, int y, float* rgb) const {
+            uint32_t hash = static_cast<uint32_t>(x) * 374761393u + static_cast<uint32_t>(y) * 668265263u + static_cast<uint32_t>(seed) * 2246822519u;
+            hash = (hash ^ (hash >> 13)) * 1274126177u;
+            hash ^= hash >> 16;
+
+            if(density < 1.0f) {
+                if((hash & 0xFFFF) / 65535.0f >= density) {
+                    return;
+                }
+
+                // Bright or dark speck, like a film grain point (upper bits, the lower ones picked the pixel)
+                float alpha     = (((hash >> 16) & 0x7FFF) / 32767.0f) * intensity;
+                float target    = (hash & 0x80000000u) ? 1.0f : 0.0f;
+
+                for(int channel = 0; channel < 3; channel++) {
+                    rgb[channel] += (target - rgb[channel]) * alpha;
+                }
+
+                return;
+            }
+
+            float noise = ((hash & 0xFFFF) / 65535.0f - 0.5f) * intensity;
+
+            rgb[0] += noise;
+            rgb[1] += noise;
+            rgb[2] += noise;
+        }
+
+        void ColorGradePass::Shade(int x, int y, float* rgb) const {
+            (void) x;
+            (void) y;
+
+            float luminance = 0.2126f * rgb[0] + 0.7152f * rgb[1] + 0.0722f * rgb[2];
+
+            for(int channel = 0; channel < 3; channel++) {
+                float value = luminance + (rgb[channel] - luminance) * saturation;
+                rgb[channel] = (value * brightness - 0.5f) * contrast + 0.5f;
+            }
+        }
+
+        void PostProcess::Apply(const Image& source, int width, int height, Image& target) {
+            timings.clear();
+
+            if(source.IsEmpty() || width <= 0 || height <= 0) {
+                target = Image{};
+                return;
+            }
+
+            for(auto& pass : passes) {
+                pass->Prepare(width, height);
+            }
+
+            Image work;
+            work.width  = width;
+            work.height = height;
+            work.pixels.resize(work.GetStride() * height);
+
+            Image scratch;
+            size_t index = 0;
+
+            auto measure = [this, height](const std::string& name, const std::function<void(int, int)>& job) {
+                auto start = std::chrono::steady_clock::now();
+                Run(height, job);
+                std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+                timings.push_back({ name, elapsed.count() });
+            };
+
+            // Resampling is fused with the pointwise passes at the front of the chain
+            std::vector<const PostPass*> group = CollectPointwise(index);
+
+            measure(JoinNames("resample", group), [&](int top, int bottom) {
+                Resample(source, work, top, bottom);
+                ShadeRows(group, work, top, bottom);
+            });
+
+            while(index < passes.size()) {
+                group = CollectPointwise(index);
+
+                if(!group.empty()) {
+                    measure(JoinNames("", group), [&](int top, int bottom) {
+                        ShadeRows(group, work, top, bottom);
+                    });
+                    continue;
+                }
+
+                const PostPass* pass = passes[index++].get();
+                scratch.width   = width;
+                scratch.height  = height;
+                scratch.pixels.resize(work.pixels.size());
+
+                auto start = std::chrono::steady_clock::now();
+
+                // Every sweep needs the complete previous one, tiles only split rows
+                for(int sweep = 0; sweep < pass->GetSweeps(); sweep++) {
+                    Run(height, [&](int top, int bottom) {
+                        pass->Process(sweep, work, scratch, top, bottom);
+                    });
+                    std::swap(work, scratch);
+                }
+
+                std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+                timings.push_back({ pass->GetName(), elapsed.count() });
+            }
+
+            target = std::move(work);
+
+            std::cout << "[PostProcess] " << width << "x" << height << " in " << GetTotalTime() << " ms (";
+
+            for(size_t step = 0; step < timings.size(); step++) {
+                std::cout << (step > 0 ? ", " : "") << timings[step].name << " " << timings[step].milliseconds << " ms";
+            }
+
+            std::cout << ")" << std::endl;
+        }
+
+        double PostProcess::GetTotalTime() const {
+            double total = 0.0;
+
+            for(const Timing& timing : timings) {
+                total += timing.milliseconds;
+            }
+
+            return total;
+        }
+
+        void PostProcess::Run(int height, const std::function<void(int, int)>& job) {
+            int tiles = (height + tileRows - 1) / tileRows;
+            std::atomic<int> next(0);
+
+            auto worker = [&]() {
+                for(int tile = next++; tile < tiles; tile = next++) {
+                    int top = tile * tileRows;
+                    job(top, std::min(top + tileRows, height));
+                }
+            };
+
+            std::vector<std::future<void>> helpers;
+
+            try {
+                ThreadPool& pool = ::Engine::Engine::GetInstance().GetThreadPool();
+                size_t count = std::min(pool.GetThreadCount(), static_cast<size_t>(std::max(tiles - 1, 0)));
+
+                for(size_t helper = 0; helper < count; helper++) {
+                    helpers.push_back(pool.Enqueue(worker));
+                }
+            } catch(const std::exception&) {
+                // Pool already stopped (shutdown), this thread takes every tile
+            }
+
+            worker();
+
+            for(std::future<void>& helper : helpers) {
+                helper.wait();
+            }
+        }
+
+        std::vector<const PostPass*> PostProcess::CollectPointwise(size_t& index) const {
+            std::vector<const PostPass*> group;
+
+            while(index < passes.size() && passes[index]->IsPointwise()) {
+                group.push_back(passes[index++].get());
+            }
+
+            return group;
+        }
+
+        std::string PostProcess::JoinNames(const std::string& prefix, const std::vector<const PostPass*>& group) {
+            std::string name = prefix;
+
+            for(const PostPass* pass : group) {
+                if(!name.empty()) {
+                    name += "+";
+                }
+
+                name += pass->GetName();
+            }
+
+            return name;
+        }
+    }
+}
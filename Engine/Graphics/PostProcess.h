@@ -0,0 +1,152 @@
+#pragma once
+#include "Image.h"
+#include "Color.h"
+#include <string>
+#include <vector>
+#include <memory>
+#include <functional>
+#include <utility>
+
+namespace Engine {
+    namespace Graphics {
+        /*
+         * One step of a post-processing chain on an RGBA8 image. Pointwise
+         * passes only look at their own pixel, so consecutive ones are fused
+         * into a single sweep over each tile. Other passes read neighbours
+         * and need the complete output of the previous step.
+         */
+        class PostPass {
+            public:
+                virtual ~PostPass() {}
+
+                virtual const char* GetName() const = 0;
+                virtual bool IsPointwise() const { return false; }
+
+                // Called once per Apply with the output size
+                virtual void Prepare(int width, int height);
+
+                // Pointwise: transforms one pixel (straight RGB, 0..1) in place
+                virtual void Shade(int x, int y, float* rgb) const;
+
+                // Neighbourhood: rows [top, bottom) of one sweep from source to target
+                virtual int GetSweeps() const { return 1; }
+                virtual void Process(int sweep, const Image& source, Image& target, int top, int bottom) const;
+        };
+
+        // Separable box blur, horizontal then vertical
+        class BlurPass : public PostPass {
+            public:
+                explicit BlurPass(int radius) : radius(radius) {}
+
+                const char* GetName() const override { return "blur"; }
+                int GetSweeps() const override { return 2; }
+                void Process(int sweep, const Image& source, Image& target, int top, int bottom) const override;
+
+            private:
+                int radius;
+        };
+
+        // Horizontal lines of lineWidth every lineSpacing + lineWidth pixels
+        class ScanlinePass : public PostPass {
+            public:
+                ScanlinePass(float lineSpacing, float lineWidth, Color color);
+
+                const char* GetName() const override { return "scanline"; }
+                bool IsPointwise() const override { return true; }
+                void Shade(int x, int y, float* rgb) const override;
+
+            private:
+                float period;
+                float lineWidth;
+                float color[4];
+        };
+
+        // Darkens towards the corners, starting at radius (0 center, 1 corner)
+        class VignettePass : public PostPass {
+            public:
+                VignettePass(float strength, float radius = 0.5f) : strength(strength), radius(radius) {}
+
+                const char* GetName() const override { return "vignette"; }
+                bool IsPointwise() const override { return true; }
+                void Prepare(int width, int height) override;
+                void Shade(int x, int y, float* rgb) const override;
+
+            private:
+                float strength;
+                float radius;
+                float centerX       = 0.0f;
+                float centerY       = 0.0f;
+                float inverseExtent = 0.0f;
+        };
+
+        // Stable per-pixel noise, the same seed gives the same grain. Below a density of 1 only
+        // that share of pixels gets a grain, blended towards white or black by up to intensity.
+        class GrainPass : public PostPass {
+            public:
+                GrainPass(float intensity, int seed = 0, float density = 1.0f) : intensity(intensity), density(density), seed(seed) {}
+
+                const char* GetName() const override { return "grain"; }
+                bool IsPointwise() const override { return true; }
+                void Shade(int x, int y, float* rgb) const override;
+
+            private:
+                float intensity;
+                float density;
+                int seed;
+        };
+
+        class ColorGradePass : public PostPass {
+            public:
+                ColorGradePass(float brightness, float contrast = 1.0f, float saturation = 1.0f)
+                    : brightness(brightness), contrast(contrast), saturation(saturation) {}
+
+                const char* GetName() const override { return "grade"; }
+                bool IsPointwise() const override { return true; }
+                void Shade(int x, int y, float* rgb) const override;
+
+            private:
+                float brightness;
+                float contrast;
+                float saturation;
+        };
+
+        /*
+         * Chain of passes applied to a CPU image. The source is resampled to
+         * the output size, then every step runs tile by tile on the engine's
+         * ThreadPool (the calling thread works on tiles too).
+         */
+        class PostProcess {
+            public:
+                struct Timing {
+                    std::string name;       // Fused passes are joined with '+'
+                    double milliseconds;
+                };
+
+                template<typename T, typename... Args>
+                T& Add(Args&&... args) {
+                    passes.push_back(std::make_unique<T>(std::forward<Args>(args)...));
+                    return static_cast<T&>(*passes.back());
+                }
+
+                void Clear() { passes.clear(); }
+                bool IsEmpty() const { return passes.empty(); }
+
+                void SetTileRows(int rows) { tileRows = rows > 0 ? rows : 1; }
+
+                void Apply(const Image& source, int width, int height, Image& target);
+
+                // Steps of the last Apply
+                const std::vector<Timing>& GetTimings() const { return timings; }
+                double GetTotalTime() const;
+
+            private:
+                void Run(int height, const std::function<void(int, int)>& job);
+                std::vector<const PostPass*> CollectPointwise(size_t& index) const;
+                static std::string JoinNames(const std::string& prefix, const std::vector<const PostPass*>& group);
+
+                std::vector<std::unique_ptr<PostPass>> passes;
+                std::vector<Timing> timings;
+                int tileRows = 32;
+        };
+    }
+}
@@ -0,0 +1,73 @@
+#pragma once
+#include <algorithm>
+
+namespace Engine {
+    namespace Graphics {
+        // Axis-aligned rectangle in window coordinates (top-left origin)
+        struct Rect {
+            float x         = 0.0f;
+            float y         = 0.0f;
+            float width     = 0.0f;
+            float height    = 0.0f;
+
+            Rect() = default;
+            Rect(float x, float y, float width, float height) : x(x), y(y), width(width), height(height) {}
+
+            bool IsEmpty() const { return width <= 0.0f || height <= 0.0f; }
+            float GetRight() const { return x + width; }
+            float GetBottom() const { return y + height; }
+
+            bool Contains(float px, float py) const {
+                return px >= x && px <= x + width && py >= y && py <= y + height;
+            }
+
+            bool Intersects(const Rect& other) const {
+                return !IsEmpty() && !other.IsEmpty() &&
+                    x < other.GetRight() && other.x < GetRight() &&
+                    y < other.GetBottom() && other.y < GetBottom();
+            }
+
+            Rect Union(const Rect& other) const {
+                if(IsEmpty()) {
+                    return other;
+                }
+
+                if(other.IsEmpty()) {
+                    return *this;
+                }
+
+                float left      = std::min(x, other.x);
+                float top       = std::min(y, other.y);
+                float right     = std::max(GetRight(), other.GetRight());
+                float bottom    = std::max(GetBottom(), other.GetBottom());
+
+                return Rect(left, top, right - left, bottom - top);
+            }
+
+            Rect Intersection(const Rect& other) const {
+                float left      = std::max(x, other.x);
+                float top       = std::max(y, other.y);
+                float right     = std::min(GetRight(), other.GetRight());
+                float bottom    = std::min(GetBottom(), other.GetBottom());
+
+                if(right <= left || bottom <= top) {
+                    return Rect();
+                }
+
+                return Rect(left, top, right - left, bottom - top);
+            }
+
+            Rect Expand(float amount) const {
+                return Rect(x - amount, y - amount, width + amount * 2.0f, height + amount * 2.0f);
+            }
+
+            bool operator==(const Rect& other) const {
+                return x == other.x && y == other.y && width == other.width && height == other.height;
+            }
+
+            bool operator!=(const Rect& other) const {
+                return !(*this == other);
+            }
+        };
+    }
+}
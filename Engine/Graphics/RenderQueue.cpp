@@ -0,0 +1,177 @@
+#include "RenderQueue.h"
+#include "RenderStats.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Engine {
+    namespace Graphics {
+        void QuadCommand::SetRect(float x, float y, float width, float height) {
+            const float corners[8] = { x, y, x + width, y, x + width, y + height, x, y + height };
+            std::copy(corners, corners + 8, positions);
+        }
+
+        void QuadCommand::SetTexCoords(float u0, float v0, float u1, float v1) {
+            const float corners[8] = { u0, v0, u1, v0, u1, v1, u0, v1 };
+            std::copy(corners, corners + 8, texCoords);
+        }
+
+        void QuadCommand::SetColor(Color value) {
+            color[0] = value.GetRed();
+            color[1] = value.GetGreen();
+            color[2] = value.GetBlue();
+            color[3] = value.GetAlpha();
+        }
+
+        void QuadCommand::Rotate(float degrees) {
+            if(degrees == 0.0f) {
+                return;
+            }
+
+            float centerX   = (positions[0] + positions[4]) * 0.5f;
+            float centerY   = (positions[1] + positions[5]) * 0.5f;
+            float radians   = degrees * 3.14159265f / 180.0f;
+            float cosine    = std::cos(radians);
+            float sine      = std::sin(radians);
+
+            for(int corner = 0; corner < 4; corner++) {
+                float dx = positions[corner * 2] - centerX;
+                float dy = positions[corner * 2 + 1] - centerY;
+                positions[corner * 2]       = centerX + dx * cosine - dy * sine;
+                positions[corner * 2 + 1]   = centerY + dx * sine + dy * cosine;
+            }
+        }
+
+        Rect QuadCommand::GetBounds() const {
+            float left      = positions[0];
+            float top       = positions[1];
+            float right     = left;
+            float bottom    = top;
+
+            for(int corner = 1; corner < 4; corner++) {
+                left    = std::min(left, positions[corner * 2]);
+                right   = std::max(right, positions[corner * 2]);
+                top     = std::min(top, positions[corner * 2 + 1]);
+                bottom  = std::max(bottom, positions[corner * 2 + 1]);
+            }
+
+            return Rect(left, top, right - left, bottom - top);
+        }
+
+        void RenderQueue::SetLayer(int value) {
+            layer = std::max(0, std::min(value, 0xFF));
+        }
+
+        bool RenderQueue::Submit(const QuadCommand& command) {
+            if(commands.size() >= MAX_COMMANDS) {
+                return false;
+            }
+
+            Rect bounds     = command.GetBounds();
+            uint32_t state  = GetState(command);
+            int depth       = FindDepth(state, bounds);
+
+            keys.push_back(MakeKey(layer, depth, command.blend, command.texture, static_cast<uint32_t>(commands.size())));
+            commands.push_back(command);
+
+            for(Occupancy& entry : occupancy) {
+                if(entry.layer == layer && entry.depth == depth && entry.state == state) {
+                    entry.bounds = entry.bounds.Union(bounds);
+                    return true;
+                }
+            }
+
+            occupancy.push_back({ layer, depth, state, bounds });
+            return true;
+        }
+
+        const std::vector<uint32_t>& RenderQueue::Sort() {
+            size_t count = keys.size();
+            order.resize(count);
+            scratch.resize(count);
+
+            for(size_t index = 0; index < count; index++) {
+                order[index] = static_cast<uint32_t>(index);
+            }
+
+            // LSD radix sort, 8 bits per pass (stable, so equal keys keep their order)
+            for(int shift = 0; shift < 64 && count > 1; shift += 8) {
+                size_t histogram[256] = {};
+
+                for(uint32_t index : order) {
+                    histogram[(keys[index] >> shift) & 0xFF]++;
+                }
+
+                // Every key has the same byte here, the pass would not move anything
+                if(histogram[(keys[order[0]] >> shift) & 0xFF] == count) {
+                    continue;
+                }
+
+                size_t offset = 0;
+
+                for(size_t& bucket : histogram) {
+                    size_t size = bucket;
+                    bucket = offset;
+                    offset += size;
+                }
+
+                for(uint32_t index : order) {
+                    scratch[histogram[(keys[index] >> shift) & 0xFF]++] = index;
+                }
+
+                order.swap(scratch);
+            }
+
+            // Draw calls needed with and without sorting
+            runs            = 0;
+            unsortedRuns    = 0;
+
+            for(size_t index = 0; index < count; index++) {
+                if(index == 0 || GetState(commands[order[index]]) != GetState(commands[order[index - 1]])) {
+                    runs++;
+                }
+
+                if(index == 0 || GetState(commands[index]) != GetState(commands[index - 1])) {
+                    unsortedRuns++;
+                }
+            }
+
+            RenderStats::GetInstance().AddQueue(count, runs, unsortedRuns);
+
+            return order;
+        }
+
+        void RenderQueue::Clear() {
+            commands.clear();
+            keys.clear();
+            occupancy.clear();
+            order.clear();
+        }
+
+        uint64_t RenderQueue::MakeKey(int layer, int depth, BlendMode blend, unsigned int texture, uint32_t sequence) {
+            return (static_cast<uint64_t>(layer & 0xFF) << 56) |
+                   (static_cast<uint64_t>(depth & 0xFFFF) << 40) |
+                   (static_cast<uint64_t>(static_cast<uint8_t>(blend) & 0x3) << 38) |
+                   (static_cast<uint64_t>(texture & 0x3FFFFF) << 16) |
+                   static_cast<uint64_t>(sequence & 0xFFFF);
+        }
+
+        uint32_t RenderQueue::GetState(const QuadCommand& command) {
+            return (static_cast<uint32_t>(command.blend) << 22) | (command.texture & 0x3FFFFF);
+        }
+
+        int RenderQueue::FindDepth(uint32_t state, const Rect& bounds) const {
+            int depth = 0;
+
+            for(const Occupancy& entry : occupancy) {
+                if(entry.layer != layer || !entry.bounds.Intersects(bounds)) {
+                    continue;
+                }
+
+                // Same state batches together, anything else has to be drawn first
+                depth = std::max(depth, entry.state == state ? entry.depth : entry.depth + 1);
+            }
+
+            return std::min(depth, 0xFFFF);
+        }
+    }
+}
@@ -0,0 +1,90 @@
+#pragma once
+#include "Rect.h"
+#include "Color.h"
+#include <vector>
+#include <cstdint>
+
+namespace Engine {
+    namespace Graphics {
+        enum class BlendMode : uint8_t {
+            NONE            = 0,
+            ALPHA           = 1,
+            DISTANCE        = 2,    // Alpha blended, texture alpha is a signed distance thresholded at 0.5
+            PREMULTIPLIED   = 3     // Color already multiplied by alpha (offscreen rendered text)
+        };
+
+        // One textured or solid quad (texture 0), corners in clockwise order from top-left
+        struct QuadCommand {
+            unsigned int texture    = 0;
+            BlendMode blend         = BlendMode::ALPHA;
+            float positions[8]      = {};
+            float texCoords[8]      = {};
+            float color[4]          = { 1.0f, 1.0f, 1.0f, 1.0f };
+
+            void SetRect(float x, float y, float width, float height);
+            void SetTexCoords(float u0, float v0, float u1, float v1);
+            void SetColor(Color value);
+            void Rotate(float degrees);     // Around the center of the quad
+            Rect GetBounds() const;
+        };
+
+        /*
+         * Collects the quads of a batch and sorts them by a 64-bit key:
+         *
+         *   layer (8) | depth (16) | blend (2) | texture (22) | sequence (16)
+         *
+         * Depth is the painter's order: a quad goes one level above every
+         * earlier quad with a different state it overlaps, so reordering by
+         * state never changes what ends up on top. Quads of the same state
+         * stay in submission order through the sequence bits.
+         */
+        class RenderQueue {
+            public:
+                static const size_t MAX_COMMANDS = 0xFFFF;
+
+                void SetLayer(int layer);
+                int GetLayer() const { return layer; }
+
+                // Returns false if the queue is full and has to be flushed first
+                bool Submit(const QuadCommand& command);
+
+                // Radix sort of the submitted quads, valid until Clear()
+                const std::vector<uint32_t>& Sort();
+                const QuadCommand& Get(uint32_t index) const { return commands[index]; }
+
+                void Clear();
+                bool IsEmpty() const { return commands.empty(); }
+                size_t GetSize() const { return commands.size(); }
+
+                // State runs (one draw call each) in sorted and submission order
+                uint64_t GetRuns() const { return runs; }
+                uint64_t GetUnsortedRuns() const { return unsortedRuns; }
+
+                static uint64_t MakeKey(int layer, int depth, BlendMode blend, unsigned int texture, uint32_t sequence);
+                static uint32_t GetState(const QuadCommand& command);
+
+            private:
+                // Occupied area of one state on one depth of a layer
+                struct Occupancy {
+                    int layer;
+                    int depth;
+                    uint32_t state;
+                    Rect bounds;
+                };
+
+                int FindDepth(uint32_t state, const Rect& bounds) const;
+
+                int layer = 0;
+                std::vector<QuadCommand> commands;
+                std::vector<uint64_t> keys;
+                std::vector<Occupancy> occupancy;
+
+                // Sort buffers, kept between frames
+                std::vector<uint32_t> order;
+                std::vector<uint32_t> scratch;
+
+                uint64_t runs = 0;
+                uint64_t unsortedRuns = 0;
+        };
+    }
+}
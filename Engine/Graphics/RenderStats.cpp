@@ -0,0 +1,65 @@
+#include "RenderStats.h"
+
+namespace Engine {
+    namespace Graphics {
+        RenderStats& RenderStats::GetInstance() {
+            static RenderStats instance;
+            return instance;
+        }
+
+        void RenderStats::EndFrame() {
+            FrameStats frame;
+            frame.drawCalls     = drawCalls.exchange(0);
+            frame.vertices      = vertexCount.exchange(0);
+            frame.textureBinds  = textureBinds.exchange(0);
+            frame.stateChanges  = stateChanges.exchange(0);
+            frame.glyphs        = glyphs.exchange(0);
+            frame.layouts       = layouts.exchange(0);
+            frame.layoutHits    = layoutHits.exchange(0);
+            frame.layoutTime    = layoutTime.exchange(0);
+            frame.effectGlyphs  = effectGlyphs.exchange(0);
+            frame.effectTime    = effectTime.exchange(0);
+            frame.bytesUploaded = bytesUploaded.exchange(0);
+            frame.queuedQuads   = queuedQuads.exchange(0);
+            frame.queueRuns     = queueRuns.exchange(0);
+            frame.unsortedRuns  = unsortedRuns.exchange(0);
+            frame.culledQuads   = culledQuads.exchange(0);
+            frame.arenaBytes    = arenaBytes.exchange(0);
+            frame.arenaHighWater = arenaHighWater.exchange(0);
+
+            {
+                std::lock_guard<std::mutex> lock(lastMutex);
+                lastFrame = frame;
+            }
+
+            frames++;
+        }
+
+        FrameStats RenderStats::GetCurrentFrame() const {
+            FrameStats frame;
+            frame.drawCalls     = drawCalls.load();
+            frame.vertices      = vertexCount.load();
+            frame.textureBinds  = textureBinds.load();
+            frame.stateChanges  = stateChanges.load();
+            frame.glyphs        = glyphs.load();
+            frame.layouts       = layouts.load();
+            frame.layoutHits    = layoutHits.load();
+            frame.layoutTime    = layoutTime.load();
+            frame.effectGlyphs  = effectGlyphs.load();
+            frame.effectTime    = effectTime.load();
+            frame.bytesUploaded = bytesUploaded.load();
+            frame.queuedQuads   = queuedQuads.load();
+            frame.queueRuns     = queueRuns.load();
+            frame.unsortedRuns  = unsortedRuns.load();
+            frame.culledQuads   = culledQuads.load();
+            frame.arenaBytes    = arenaBytes.load();
+            frame.arenaHighWater = arenaHighWater.load();
+            return frame;
+        }
+
+        FrameStats RenderStats::GetLastFrame() const {
+            std::lock_guard<std::mutex> lock(lastMutex);
+            return lastFrame;
+        }
+    }
+}
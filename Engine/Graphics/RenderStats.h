@@ -0,0 +1,124 @@
+#pragma once
+#include <atomic>
+#include <mutex>
+#include <cstdint>
+
+namespace Engine {
+    namespace Graphics {
+        // Work done by one presented frame
+        struct FrameStats {
+            uint64_t drawCalls      = 0;
+            uint64_t vertices       = 0;
+            uint64_t textureBinds   = 0;
+            uint64_t stateChanges   = 0;
+            uint64_t glyphs         = 0;
+            uint64_t layouts        = 0;    // Text layouts built
+            uint64_t layoutHits     = 0;    // Text drawn from a cached layout
+            uint64_t layoutTime     = 0;    // Microseconds spent building layouts
+            uint64_t effectGlyphs   = 0;    // Glyphs run through text effects
+            uint64_t effectTime     = 0;    // Nanoseconds spent in text effects
+            uint64_t bytesUploaded  = 0;
+
+            // Render queue: sorted quads and the draw calls with and without sorting
+            uint64_t queuedQuads    = 0;
+            uint64_t queueRuns      = 0;
+            uint64_t unsortedRuns   = 0;
+            uint64_t culledQuads    = 0;    // Outside the clip, never queued
+
+            // Frame arenas: bytes handed out by all threads and the largest single arena
+            uint64_t arenaBytes     = 0;
+            uint64_t arenaHighWater = 0;
+        };
+
+        /*
+         * Per-frame render counters. Backends and widgets report their work,
+         * the ViewManager closes the frame after presenting it. Counting is
+         * lock-free and may happen from any thread.
+         */
+        class RenderStats {
+            public:
+                static RenderStats& GetInstance();
+
+                void AddDrawCall(uint64_t vertices) {
+                    if(enabled) {
+                        drawCalls.fetch_add(1, std::memory_order_relaxed);
+                        vertexCount.fetch_add(vertices, std::memory_order_relaxed);
+                    }
+                }
+
+                void AddTextureBind(uint64_t count = 1) { Add(textureBinds, count); }
+                void AddStateChange(uint64_t count = 1) { Add(stateChanges, count); }
+                void AddGlyphs(uint64_t count) { Add(glyphs, count); }
+                void AddLayout() { Add(layouts, 1); }
+                void AddLayoutHit() { Add(layoutHits, 1); }
+                void AddLayoutTime(uint64_t microseconds) { Add(layoutTime, microseconds); }
+
+                void AddEffects(uint64_t glyphCount, uint64_t nanoseconds) {
+                    Add(effectGlyphs, glyphCount);
+                    Add(effectTime, nanoseconds);
+                }
+
+                void AddUpload(uint64_t bytes) { Add(bytesUploaded, bytes); }
+
+                void AddQueue(uint64_t quads, uint64_t runs, uint64_t unsorted) {
+                    Add(queuedQuads, quads);
+                    Add(queueRuns, runs);
+                    Add(unsortedRuns, unsorted);
+                }
+
+                void AddCulled(uint64_t count = 1) { Add(culledQuads, count); }
+
+                // Reported by a FrameArena when it rewinds, counted even while disabled
+                void AddArena(uint64_t bytes) {
+                    arenaBytes.fetch_add(bytes, std::memory_order_relaxed);
+
+                    uint64_t peak = arenaHighWater.load(std::memory_order_relaxed);
+                    while(bytes > peak && !arenaHighWater.compare_exchange_weak(peak, bytes, std::memory_order_relaxed)) {}
+                }
+
+                // Debug drawing (HUD, damage overlay) is excluded from the counters
+                void SetEnabled(bool state) { enabled = state; }
+                bool IsEnabled() const { return enabled; }
+
+                // Publishes the running counters as the last frame and resets them
+                void EndFrame();
+
+                FrameStats GetCurrentFrame() const;
+                FrameStats GetLastFrame() const;
+                uint64_t GetFrameCount() const { return frames.load(); }
+
+            private:
+                RenderStats() = default;
+
+                void Add(std::atomic<uint64_t>& counter, uint64_t value) {
+                    if(enabled) {
+                        counter.fetch_add(value, std::memory_order_relaxed);
+                    }
+                }
+
+                std::atomic<bool> enabled{true};
+
+                std::atomic<uint64_t> drawCalls{0};
+                std::atomic<uint64_t> vertexCount{0};
+                std::atomic<uint64_t> textureBinds{0};
+                std::atomic<uint64_t> stateChanges{0};
+                std::atomic<uint64_t> glyphs{0};
+                std::atomic<uint64_t> layouts{0};
+                std::atomic<uint64_t> layoutHits{0};
+                std::atomic<uint64_t> layoutTime{0};
+                std::atomic<uint64_t> effectGlyphs{0};
+                std::atomic<uint64_t> effectTime{0};
+                std::atomic<uint64_t> bytesUploaded{0};
+                std::atomic<uint64_t> queuedQuads{0};
+                std::atomic<uint64_t> queueRuns{0};
+                std::atomic<uint64_t> unsortedRuns{0};
+                std::atomic<uint64_t> culledQuads{0};
+                std::atomic<uint64_t> arenaBytes{0};
+                std::atomic<uint64_t> arenaHighWater{0};
+
+                std::atomic<uint64_t> frames{0};
+                FrameStats lastFrame;
+                mutable std::mutex lastMutex;
+        };
+    }
+}
@@ -0,0 +1,17 @@
+#pragma once
+#include "Texture.h"
+
+namespace Engine {
+    namespace Graphics {
+        // Offscreen surface: a framebuffer with a color texture attached
+        class RenderTarget {
+            public:
+                unsigned int framebuffer = 0;
+                Texture texture{};
+                int width   = 0;
+                int height  = 0;
+
+                bool IsValid() const { return framebuffer != 0; }
+        };
+    }
+}
@@ -0,0 +1,198 @@
+#include "Shape.h"
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE2__)
+    #include <emmintrin.h>
+#endif
+
+namespace Engine {
+    namespace Graphics {
+        namespace {
+            float Clamp01(float value) {
+                return std::max(0.0f, std::min(value, 1.0f));
+            }
+
+            float SmoothStep(float edge0, float edge1, float value) {
+                float t = Clamp01((value - edge0) / (edge1 - edge0));
+                return t * t * (3.0f - 2.0f * t);
+            }
+
+            void CopyColor(Color color, float* target) {
+                target[0] = color.GetRed();
+                target[1] = color.GetGreen();
+                target[2] = color.GetBlue();
+                target[3] = color.GetAlpha();
+            }
+
+            // Color of a pixel from its distance to the shape edge
+            void Shade(const Shape& shape, float px, float py, float distance, float* rgba) {
+                float color[4] = { shape.fill[0], shape.fill[1], shape.fill[2], shape.fill[3] };
+
+                if(shape.gradient != GradientType::NONE) {
+                    float t = 0.0f;
+                    float dx = px - shape.gradientStart[0];
+                    float dy = py - shape.gradientStart[1];
+
+                    if(shape.gradient == GradientType::LINEAR) {
+                        float dirX      = shape.gradientEnd[0] - shape.gradientStart[0];
+                        float dirY      = shape.gradientEnd[1] - shape.gradientStart[1];
+                        float length    = std::max(dirX * dirX + dirY * dirY, 0.0001f);
+                        t = Clamp01((dx * dirX + dy * dirY) / length);
+                    } else {
+                        t = Clamp01(std::sqrt(dx * dx + dy * dy) / std::max(shape.gradientEnd[0], 0.0001f));
+                    }
+
+                    for(int channel = 0; channel < 4; channel++) {
+                        color[channel] += (shape.gradientColor[channel] - color[channel]) * t;
+                    }
+                }
+
+                float coverage;
+
+                if(shape.type == ShapeType::SHADOW) {
+                    float softness = std::max(shape.softness, 0.0001f);
+                    coverage = 1.0f - SmoothStep(-softness, softness, distance);
+                } else {
+                    // One pixel wide anti-aliased edge
+                    coverage = Clamp01(0.5f - distance);
+
+                    if(shape.type == ShapeType::ROUNDED_RECT && shape.borderWidth > 0.0f) {
+                        float band = Clamp01(distance + shape.borderWidth + 0.5f);
+
+                        for(int channel = 0; channel < 4; channel++) {
+                            color[channel] += (shape.border[channel] - color[channel]) * band;
+                        }
+                    }
+                }
+
+                rgba[0] = color[0];
+                rgba[1] = color[1];
+                rgba[2] = color[2];
+                rgba[3] = color[3] * coverage;
+            }
+
+            void Store(const float* color, uint8_t* target) {
+                for(int channel = 0; channel < 4; channel++) {
+                    target[channel] = static_cast<uint8_t>(Clamp01(color[channel]) * 255.0f + 0.5f);
+                }
+            }
+        }
+
+        Shape::Shape(ShapeType type, const Rect& bounds, Color color, float radius) : type(type), bounds(bounds), radius(radius) {
+            SetFill(color);
+        }
+
+        void Shape::SetFill(Color color) {
+            CopyColor(color, fill);
+        }
+
+        void Shape::SetBorder(float width, Color color) {
+            borderWidth = width;
+            CopyColor(color, border);
+        }
+
+        void Shape::SetLinearGradient(Color color, float startX, float startY, float endX, float endY) {
+            gradient            = GradientType::LINEAR;
+            gradientStart[0]    = startX;
+            gradientStart[1]    = startY;
+            gradientEnd[0]      = endX;
+            gradientEnd[1]      = endY;
+            CopyColor(color, gradientColor);
+        }
+
+        void Shape::SetRadialGradient(Color color, float centerX, float centerY, float gradientRadius) {
+            gradient            = GradientType::RADIAL;
+            gradientStart[0]    = centerX;
+            gradientStart[1]    = centerY;
+            gradientEnd[0]      = gradientRadius;
+            gradientEnd[1]      = 0.0f;
+            CopyColor(color, gradientColor);
+        }
+
+        Rect Shape::GetCoverage() const {
+            float margin = 1.0f;
+
+            if(type == ShapeType::SHADOW) {
+                margin += softness;
+            }
+
+            return bounds.Expand(margin);
+        }
+
+        float Shape::GetDistance(float px, float py) const {
+            float halfWidth     = bounds.width * 0.5f;
+            float halfHeight    = bounds.height * 0.5f;
+            float dx            = px - (bounds.x + halfWidth);
+            float dy            = py - (bounds.y + halfHeight);
+
+            if(type == ShapeType::RING) {
+                float thickness = std::max(borderWidth, 1.0f);
+                float middle    = std::min(halfWidth, halfHeight) - thickness * 0.5f;
+                return std::fabs(std::sqrt(dx * dx + dy * dy) - middle) - thickness * 0.5f;
+            }
+
+            // Rounded box: distance to the inner rect, minus the corner radius
+            float corner    = std::min(radius, std::min(halfWidth, halfHeight));
+            float qx        = std::fabs(dx) - halfWidth + corner;
+            float qy        = std::fabs(dy) - halfHeight + corner;
+            float ox        = std::max(qx, 0.0f);
+            float oy        = std::max(qy, 0.0f);
+
+            return std::sqrt(ox * ox + oy * oy) + std::min(std::max(qx, qy), 0.0f) - corner;
+        }
+
+        void Shape::Evaluate(float px, float py, float* rgba) const {
+            Shade(*this, px, py, GetDistance(px, py), rgba);
+        }
+
+        void Shape::EvaluateRow(float x, float y, int count, uint8_t* rgba) const {
+            float py    = y + 0.5f;
+            int index   = 0;
+            float color[4];
+
+#if defined(__SSE2__)
+            // Four distances at once, the row shares its vertical term
+            if(type != ShapeType::RING) {
+                float halfWidth     = bounds.width * 0.5f;
+                float halfHeight    = bounds.height * 0.5f;
+                float corner        = std::min(radius, std::min(halfWidth, halfHeight));
+                float qy            = std::fabs(py - (bounds.y + halfHeight)) - halfHeight + corner;
+
+                const __m128 signMask   = _mm_set1_ps(-0.0f);
+                const __m128 zero       = _mm_setzero_ps();
+                const __m128 centerX    = _mm_set1_ps(bounds.x + halfWidth);
+                const __m128 extentX    = _mm_set1_ps(halfWidth - corner);
+                const __m128 cornerV    = _mm_set1_ps(corner);
+                const __m128 qyV        = _mm_set1_ps(qy);
+                const __m128 oySquared  = _mm_set1_ps(std::max(qy, 0.0f) * std::max(qy, 0.0f));
+                const __m128 lanes      = _mm_set_ps(3.5f, 2.5f, 1.5f, 0.5f);
+
+                alignas(16) float distances[4];
+
+                for(; index + 4 <= count; index += 4) {
+                    __m128 px = _mm_add_ps(_mm_set1_ps(x + static_cast<float>(index)), lanes);
+                    __m128 qx = _mm_sub_ps(_mm_andnot_ps(signMask, _mm_sub_ps(px, centerX)), extentX);
+                    __m128 ox = _mm_max_ps(qx, zero);
+
+                    __m128 outside  = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(ox, ox), oySquared));
+                    __m128 inside   = _mm_min_ps(_mm_max_ps(qx, qyV), zero);
+
+                    _mm_store_ps(distances, _mm_sub_ps(_mm_add_ps(outside, inside), cornerV));
+
+                    for(int lane = 0; lane < 4; lane++) {
+                        Shade(*this, x + static_cast<float>(index + lane) + 0.5f, py, distances[lane], color);
+                        Store(color, rgba + (index + lane) * 4);
+                    }
+                }
+            }
+#endif
+
+            for(; index < count; index++) {
+                float px = x + static_cast<float>(index) + 0.5f;
+                Shade(*this, px, py, GetDistance(px, py), color);
+                Store(color, rgba + index * 4);
+            }
+        }
+    }
+}
@@ -0,0 +1,61 @@
+#pragma once
+#include "Color.h"
+#include "Rect.h"
+#include <cstdint>
+
+namespace Engine {
+    namespace Graphics {
+        enum class ShapeType : uint8_t {
+            ROUNDED_RECT,   // Fill with optional border, radius 0 is a plain rect
+            SHADOW,         // Soft rounded rect, softness is the blur distance
+            RING            // Circle outline of borderWidth inside the bounds
+        };
+
+        enum class GradientType : uint8_t {
+            NONE,
+            LINEAR,         // From start to end point
+            RADIAL          // Around the start point, end.x is the radius
+        };
+
+        /*
+         * Primitive evaluated analytically per pixel from its signed distance,
+         * so a rounded, bordered, shadowed or gradient filled rect is a single
+         * quad. Points are absolute coordinates; colors are straight RGBA.
+         */
+        struct Shape {
+            ShapeType type          = ShapeType::ROUNDED_RECT;
+            Rect bounds;
+            float radius            = 0.0f;
+            float borderWidth       = 0.0f;
+            float softness          = 0.0f;
+
+            float fill[4]           = { 1.0f, 1.0f, 1.0f, 1.0f };
+            float border[4]         = { 0.0f, 0.0f, 0.0f, 0.0f };
+
+            GradientType gradient   = GradientType::NONE;
+            float gradientColor[4]  = { 0.0f, 0.0f, 0.0f, 0.0f };
+            float gradientStart[2]  = { 0.0f, 0.0f };
+            float gradientEnd[2]    = { 0.0f, 0.0f };
+
+            Shape() = default;
+            Shape(ShapeType type, const Rect& bounds, Color color, float radius = 0.0f);
+
+            void SetFill(Color color);
+            void SetBorder(float width, Color color);
+            void SetLinearGradient(Color color, float startX, float startY, float endX, float endY);
+            void SetRadialGradient(Color color, float centerX, float centerY, float gradientRadius);
+
+            // Area the shape can touch (soft edges and anti-aliasing included)
+            Rect GetCoverage() const;
+
+            // Signed distance in pixels, negative inside
+            float GetDistance(float px, float py) const;
+
+            // Straight RGBA of one pixel center
+            void Evaluate(float px, float py, float* rgba) const;
+
+            // Rasterizes count pixels starting at (x, y) into straight RGBA bytes (SSE where available)
+            void EvaluateRow(float x, float y, int count, uint8_t* rgba) const;
+        };
+    }
+}
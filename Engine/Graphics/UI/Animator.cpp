@@ -1,7 +1,10 @@
 #include "Animator.h"
 #include "Text/Text.h"
+#include "Text/Utf8.h"
 #include "../IRenderingAPI.h"
+#include "../RenderStats.h"
 #include <algorithm>
+#include <chrono>
 
 // Fix Windows macro conflicts
 #ifdef GetCurrentTime
@@ -10,6 +13,83 @@
 
 namespace Engine {
     namespace Graphics {
+        GlyphStream::GlyphStream()
+            : x(&FrameArena::Get()), y(&FrameArena::Get()),
+              width(&FrameArena::Get()), height(&FrameArena::Get()),
+              scale(&FrameArena::Get()), rotation(&FrameArena::Get()),
+              alpha(&FrameArena::Get()), color(&FrameArena::Get()),
+              index(&FrameArena::Get()), visible(&FrameArena::Get()) {}
+
+        void GlyphStream::Reserve(size_t count) {
+            x.reserve(count);
+            y.reserve(count);
+            width.reserve(count);
+            height.reserve(count);
+            scale.reserve(count);
+            rotation.reserve(count);
+            alpha.reserve(count);
+            color.reserve(count);
+            index.reserve(count);
+            visible.reserve(count);
+        }
+
+        void GlyphStream::Push(float glyphX, float glyphY, float glyphWidth, float glyphHeight, int charIndex, Color glyphColor) {
+            x.push_back(glyphX);
+            y.push_back(glyphY);
+            width.push_back(glyphWidth);
+            height.push_back(glyphHeight);
+            scale.push_back(1.0f);
+            rotation.push_back(0.0f);
+            alpha.push_back(1.0f);
+            color.push_back(glyphColor);
+            index.push_back(charIndex);
+            visible.push_back(1);
+        }
+
+        void GlyphStream::Translate(float dx, float dy) {
+            for (size_t i = 0; i < x.size(); ++i) {
+                x[i] += dx;
+                y[i] += dy;
+            }
+        }
+
+        void GlyphStream::Scale(float factor) {
+            for (float& value : scale) {
+                value *= factor;
+            }
+        }
+
+        void GlyphStream::Fade(float factor) {
+            for (float& value : alpha) {
+                value *= factor;
+            }
+        }
+
+        CharacterRenderState GlyphStream::Get(size_t i) const {
+            CharacterRenderState state;
+            state.x = x[i];
+            state.y = y[i];
+            state.width = width[i];
+            state.height = height[i];
+            state.color = GetColor(i);
+            state.visible = visible[i] != 0;
+            state.scale = scale[i];
+            state.rotation = rotation[i];
+            return state;
+        }
+
+        void GlyphStream::Set(size_t i, const CharacterRenderState& state) {
+            x[i] = state.x;
+            y[i] = state.y;
+            width[i] = state.width;
+            height[i] = state.height;
+            color[i] = state.color;
+            alpha[i] = 1.0f;
+            visible[i] = state.visible ? 1 : 0;
+            scale[i] = state.scale;
+            rotation[i] = state.rotation;
+        }
+
         void TextAnimator::AddEffect(std::unique_ptr<TextEffect> effect) {
             if (effect) {
                 effects.push_back(std::move(effect));
@@ -27,7 +107,7 @@ namespace Engine {
             RemoveFinishedEffects();
         }
 
-        void TextAnimator::ApplyEffects(IRenderingAPI& context, const std::string& text,
+        void TextAnimator::ApplyEffects(IRenderingAPI& context, std::string_view text,
                                        float baseX, float baseY) {
             if (!targetText || effects.empty()) {
                 return;
@@ -48,7 +128,7 @@ namespace Engine {
             }
         }
 
-        void TextAnimator::ApplyEffectsToCharacter(IRenderingAPI& context, char character,
+        void TextAnimator::ApplyEffectsToCharacter(IRenderingAPI& context, uint32_t character,
                                                  int charIndex, CharacterRenderState& renderState) {
             (void)context; (void)character;
             if (effects.empty()) {
@@ -65,6 +145,23 @@ namespace Engine {
             }
         }
 
+        void TextAnimator::ApplyEffectsToStream(GlyphStream& glyphs) {
+            if (effects.empty() || glyphs.Size() == 0) {
+                return;
+            }
+
+            auto started = std::chrono::steady_clock::now();
+
+            for (auto& effect : effects) {
+                if (effect && !effect->IsFinished() && effect->HasStarted()) {
+                    effect->ApplyToStream(glyphs, effect->GetEffectTime());
+                }
+            }
+
+            std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - started;
+            RenderStats::GetInstance().AddEffects(glyphs.Size(), static_cast<uint64_t>(elapsed.count()));
+        }
+
         void TextAnimator::RemoveFinishedEffects() {
             effects.erase(
                 std::remove_if(effects.begin(), effects.end(),
@@ -82,26 +179,26 @@ namespace Engine {
                 });
         }
 
-        std::vector<CharacterInfo> TextAnimator::CalculateCharacterPositions(const std::string& text,
+        FrameVector<CharacterInfo> TextAnimator::CalculateCharacterPositions(std::string_view text,
                                                                              float baseX, float baseY) {
-            std::vector<CharacterInfo> positions;
+            FrameVector<CharacterInfo> positions(&FrameArena::Get());
             positions.reserve(text.length());
 
             float currentX = baseX;
 
-            for (size_t i = 0; i < text.length(); ++i) {
-                char c = text[i];
+            // One entry per codepoint, not per byte
+            for (size_t offset = 0, i = 0; offset < text.length(); ++i) {
+                size_t start = offset;
 
                 CharacterInfo info;
-                info.character = c;
+                info.character = Utf8::Next(text, offset);
                 info.x = currentX;
                 info.y = baseY;
                 info.index = static_cast<int>(i);
 
                 // Get character dimensions from target text if available
                 if (targetText) {
-                    std::string singleChar(1, c);
-                    info.width = targetText->GetTextWidth(singleChar);
+                    info.width = targetText->GetTextWidth(text.substr(start, offset - start));
                     info.height = targetText->GetTextHeight();
                     currentX += info.width;
                 } else {
@@ -1,9 +1,11 @@
 #pragma once
 
 #include "Effect.h"
-#include "../RGBA.h"
+#include "../Color.h"
+#include "../../Core/FrameArena.h"
 #include <memory>
 #include <vector>
+#include <string_view>
 
 namespace Engine {
     namespace Graphics {
@@ -14,17 +16,49 @@ namespace Engine {
         struct CharacterRenderState {
             float x, y;              // Position
             float width, height;     // Dimensions
-            IColor* color;              // Color
+            Color color;             // Color
             bool visible;            // Visibility flag
             float scale;             // Scale multiplier
             float rotation;          // Rotation in degrees
 
             CharacterRenderState()
                 : x(0), y(0), width(0), height(0),
-                  color(new RGBA(255, 255, 255, 100)),
+                  color(255, 255, 255, 100),
                   visible(true), scale(1.0f), rotation(0.0f) {}
         };
 
+        /*
+         * Render state of every glyph of a text as parallel arrays, so an
+         * effect runs over a whole text in one pass. Alpha multiplies the
+         * alpha of color; effects working on CharacterRenderState see it
+         * folded in. Lives in the frame arena.
+         */
+        struct GlyphStream {
+            FrameVector<float> x, y;
+            FrameVector<float> width, height;
+            FrameVector<float> scale;
+            FrameVector<float> rotation;
+            FrameVector<float> alpha;
+            FrameVector<Color> color;
+            FrameVector<int> index;             // Character index, effects stagger characters by it
+            FrameVector<uint8_t> visible;
+
+            GlyphStream();
+
+            size_t Size() const { return x.size(); }
+            void Reserve(size_t count);
+            void Push(float glyphX, float glyphY, float glyphWidth, float glyphHeight, int charIndex, Color glyphColor);
+
+            // Same change for every glyph
+            void Translate(float dx, float dy);
+            void Scale(float factor);
+            void Fade(float factor);
+
+            Color GetColor(size_t i) const { return alpha[i] == 1.0f ? color[i] : color[i].MultiplyAlpha(alpha[i]); }
+            CharacterRenderState Get(size_t i) const;
+            void Set(size_t i, const CharacterRenderState& state);
+        };
+
         class TextAnimator {
         public:
             TextAnimator() = default;
@@ -40,13 +74,16 @@ namespace Engine {
             void Update(float deltaTime);
 
             // Apply all effects during text rendering
-            void ApplyEffects(IRenderingAPI& context, const std::string& text,
+            void ApplyEffects(IRenderingAPI& context, std::string_view text,
                              float baseX, float baseY);
 
             // Apply effects to a single character during rendering
-            void ApplyEffectsToCharacter(IRenderingAPI& context, char character,
+            void ApplyEffectsToCharacter(IRenderingAPI& context, uint32_t character,
                                        int charIndex, CharacterRenderState& renderState);
 
+            // Apply effects to every glyph of the text, one pass per effect
+            void ApplyEffectsToStream(GlyphStream& glyphs);
+
             // Clear all effects
             void ClearEffects() { effects.clear(); }
 
@@ -63,8 +100,8 @@ namespace Engine {
             Text* targetText = nullptr;
             std::vector<std::unique_ptr<TextEffect>> effects;
 
-            // Helper to calculate character positions
-            std::vector<CharacterInfo> CalculateCharacterPositions(const std::string& text,
+            // Helper to calculate character positions, the result lives in the frame arena
+            FrameVector<CharacterInfo> CalculateCharacterPositions(std::string_view text,
                                                                   float baseX, float baseY);
         };
     }
@@ -1,5 +1,6 @@
 #include "Box.h"
 #include "../../IRenderingAPI.h"
+#include "../../../Core/MemoryTracker.h"
 #include "../Effect.h"
 #include <cmath>
 
@@ -17,10 +18,10 @@ namespace Engine {
         const Alignment Alignment::BOTTOM_RIGHT(HorizontalAlignment::RIGHT, VerticalAlignment::BOTTOM);
 
         Box::Box(float width, float height) : width(width), height(height),
-            color(new RGBA(255, 255, 255, 100)),
-            borderColor(new RGBA(0, 0, 0, 100)),
-            borderWidth(0.0f), m_marginTop(0.0f), m_marginRight(0.0f), m_marginBottom(0.0f),
-            m_marginLeft(0.0f), shadowRadius(0.0f), shadowColor(new RGBA(0, 0, 0, 50)),
+            color(255, 255, 255, 100),
+            borderColor(0, 0, 0, 100),
+            borderWidth(0.0f), cornerRadius(0.0f), gradient(false), m_marginTop(0.0f), m_marginRight(0.0f), m_marginBottom(0.0f),
+            m_marginLeft(0.0f), shadowRadius(0.0f), shadowColor(0, 0, 0, 50),
             shadowOffsetX(2.0f), shadowOffsetY(2.0f) {
         }
 
@@ -28,24 +29,34 @@ namespace Engine {
             animator.Update(deltaTime);
         }
 
-        void Box::SetColor(IColor* c) {
+        void Box::SetColor(Color c) {
             color = c;
+            damage.MarkDirty();
         }
 
-        void Box::SetBorderColor(IColor* c) {
+        void Box::SetBorderColor(Color c) {
             borderColor = c;
+            damage.MarkDirty();
         }
 
-        void Box::SetShadow(float radius, IColor* color, float offsetX, float offsetY) {
+        void Box::SetGradient(Color c) {
+            gradientColor = c;
+            gradient = true;
+            damage.MarkDirty();
+        }
+
+        void Box::SetShadow(float radius, Color color, float offsetX, float offsetY) {
             shadowRadius = radius;
             shadowColor = color;
             shadowOffsetX = offsetX;
             shadowOffsetY = offsetY;
+            damage.MarkResized();
         }
 
         void Box::SetMargin(float x, float y) {
             m_marginLeft = m_marginRight = x;
             m_marginTop = m_marginBottom = y;
+            damage.MarkResized();
         }
 
         void Box::SetMargin(float top, float right, float bottom, float left) {
@@ -53,14 +64,17 @@ namespace Engine {
             m_marginRight = right;
             m_marginBottom = bottom;
             m_marginLeft = left;
+            damage.MarkResized();
         }
 
         void Box::Render(IRenderingAPI& context, float x, float y) {
+            MemoryScope memoryScope(MemoryTag::UI);
+
             float renderX = x + m_marginLeft;
             float renderY = y + m_marginTop;
             float currentWidth = width;
             float currentHeight = height;
-            IColor* currentColor = color;
+            Color currentColor = color;
 
             // Apply animator effects by using the animator's ApplyEffectsToCharacter method
             CharacterRenderState fakeState;
@@ -87,31 +101,35 @@ namespace Engine {
                 renderY = centerY - currentHeight * 0.5f;
             }
 
-            // Use OpenGL-optimized shadow rendering
+            // Shadow as one soft shape, half strength at the box edge fading out over the radius
             if (shadowRadius > 0.0f) {
-                // Create shadow color with animation alpha applied
-                float shadowAlphaMultiplier = currentColor->GetAlpha();
-                IColor* animatedShadowColor = new RGBA(shadowColor->GetRed() * 255, shadowColor->GetGreen() * 255, 
-                                                      shadowColor->GetBlue() * 255, shadowColor->GetAlpha() * shadowAlphaMultiplier * 100);
-                
-                // Render box with shadow using OpenGL blend functions
-                context.DrawRectWithShadow(renderX, renderY, currentWidth, currentHeight, currentColor, 
-                                          shadowRadius, animatedShadowColor, shadowOffsetX, shadowOffsetY);
-            } else {
-                // Render the box without shadow
-                context.DrawRect(renderX, renderY, currentWidth, currentHeight, currentColor);
+                Shape shadow(ShapeType::SHADOW, Rect(renderX + shadowOffsetX, renderY + shadowOffsetY, currentWidth, currentHeight), shadowColor, cornerRadius);
+                shadow.softness = shadowRadius;
+                shadow.fill[3] *= currentColor.GetAlpha();
+                context.DrawShape(shadow);
+            }
+
+            // Fill, gradient and border in a single quad
+            Shape body(ShapeType::ROUNDED_RECT, Rect(renderX, renderY, currentWidth, currentHeight), currentColor, cornerRadius);
+
+            if (gradient) {
+                body.SetLinearGradient(gradientColor, renderX, renderY, renderX, renderY + currentHeight);
             }
 
-            // Render border if specified
             if (borderWidth > 0.0f) {
-                IColor* currentBorderColor = borderColor;
+                body.SetBorder(borderWidth, borderColor);
+            }
+
+            context.DrawShape(body);
+
+            Rect bounds(renderX, renderY, currentWidth, currentHeight);
 
-                // Draw border as four rectangles
-                context.DrawRect(renderX, renderY, currentWidth, borderWidth, currentBorderColor); // Top
-                context.DrawRect(renderX, renderY + currentHeight - borderWidth, currentWidth, borderWidth, currentBorderColor); // Bottom
-                context.DrawRect(renderX, renderY, borderWidth, currentHeight, currentBorderColor); // Left
-                context.DrawRect(renderX + currentWidth - borderWidth, renderY, borderWidth, currentHeight, currentBorderColor); // Right
+            if (shadowRadius > 0.0f) {
+                Rect shadow(renderX + shadowOffsetX, renderY + shadowOffsetY, currentWidth, currentHeight);
+                bounds = bounds.Union(shadow.Expand(shadowRadius + 1.0f));
             }
+
+            damage.Update(bounds);
         }
 
         void Box::Render(IRenderingAPI& context, const Alignment& alignment) {
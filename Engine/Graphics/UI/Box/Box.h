@@ -1,8 +1,9 @@
 #pragma once
 
 #include "../Alignment.h"
-#include "../../RGBA.h"
+#include "../../Color.h"
 #include "../Animator.h"
+#include "../../DamageRegion.h"
 
 namespace Engine {
     namespace Graphics {
@@ -38,9 +39,9 @@ namespace Engine {
             void Render(IRenderingAPI& context, const Alignment& alignment);
 
             // Position and size
-            void SetSize(float width, float height) { this->width = width; this->height = height; }
-            void SetWidth(float width) { this->width = width; }
-            void SetHeight(float height) { this->height = height; }
+            void SetSize(float width, float height) { this->width = width; this->height = height; damage.MarkResized(); }
+            void SetWidth(float width) { this->width = width; damage.MarkResized(); }
+            void SetHeight(float height) { this->height = height; damage.MarkResized(); }
             void SetMargin(float x, float y);
             void SetMargin(float top, float right, float bottom, float left);
 
@@ -48,29 +49,41 @@ namespace Engine {
             float GetHeight() const { return height; }
 
             // Appearance
-            void SetColor(IColor* color);
-            void SetBorderColor(IColor* color);
-            void SetBorderWidth(float width) { this->borderWidth = width; }
-            void SetShadow(float radius, IColor* color, float offsetX = 2.0f, float offsetY = 2.0f);
+            void SetColor(Color color);
+            void SetBorderColor(Color color);
+            void SetBorderWidth(float width) { this->borderWidth = width; damage.MarkDirty(); }
+            void SetShadow(float radius, Color color, float offsetX = 2.0f, float offsetY = 2.0f);
+            void SetCornerRadius(float radius) { this->cornerRadius = radius; damage.MarkDirty(); }
+            void SetGradient(Color color);     // Vertical, from the fill color at the top to this color at the bottom
 
             float GetBorderWidth() const { return borderWidth; }
+            float GetCornerRadius() const { return cornerRadius; }
 
             // Animation system  
             TextAnimator& GetAnimator() { return animator; }
 
+            // Damage tracking (bounds of the last Render call, shadow included)
+            bool IsDirty() const { return damage.IsDirty() || animator.HasActiveEffects(); }
+            const Rect& GetBounds() const { return damage.GetBounds(); }
+            void CollectDamage(DamageRegion& region) const { damage.Collect(region, animator.HasActiveEffects()); }
+
         private:
             float width, height;
-            IColor* color;
-            IColor* borderColor;
+            Color color;
+            Color borderColor;
             float borderWidth;
+            float cornerRadius;
+            Color gradientColor;
+            bool gradient;
             float m_marginTop, m_marginRight, m_marginBottom, m_marginLeft;
             
             // Shadow properties
             float shadowRadius;
-            IColor* shadowColor;
+            Color shadowColor;
             float shadowOffsetX, shadowOffsetY;
             
             TextAnimator animator;
+            DamageTracker damage;
         };
     }
 }
@@ -1,5 +1,6 @@
 #include "Button.h"
 #include "../../IRenderingAPI.h"
+#include "../../../Core/MemoryTracker.h"
 
 namespace Engine {
     namespace Graphics {
@@ -16,16 +17,16 @@ namespace Engine {
               m_onHoverEndCallback(nullptr),
               m_onPressCallback(nullptr),
               m_onReleaseCallback(nullptr),
-              m_normalTextColor(new RGBA(255, 255, 255, 100)),
-              m_hoverTextColor(new RGBA(199, 199, 255, 100)),
-              m_pressedTextColor(new RGBA(150, 150, 199, 100)),
-              m_disabledTextColor(new RGBA(127, 127, 127, 100)),
-              m_normalBackgroundColor(new RGBA(0, 0, 0, 0)),
-              m_hoverBackgroundColor(new RGBA(50, 50, 50, 39)),
-              m_pressedBackgroundColor(new RGBA(99, 99, 99, 59)),
-              m_disabledBackgroundColor(new RGBA(30, 30, 30, 20)),
-              m_originalTextColor(new RGBA(255, 255, 255, 100)),
-              m_originalBackgroundColor(new RGBA(0, 0, 0, 0))
+              m_normalTextColor(255, 255, 255, 100),
+              m_hoverTextColor(199, 199, 255, 100),
+              m_pressedTextColor(150, 150, 199, 100),
+              m_disabledTextColor(127, 127, 127, 100),
+              m_normalBackgroundColor(0, 0, 0, 0),
+              m_hoverBackgroundColor(50, 50, 50, 39),
+              m_pressedBackgroundColor(99, 99, 99, 59),
+              m_disabledBackgroundColor(30, 30, 30, 20),
+              m_originalTextColor(255, 255, 255, 100),
+              m_originalBackgroundColor(0, 0, 0, 0)
         {
             // Colors are now initialized in the constructor initializer list
         }
@@ -53,6 +54,7 @@ namespace Engine {
         void Button::SetState(ButtonState state) {
             if (m_state != state) {
                 m_state = state;
+                MarkDirty();
                 UpdateAppearanceForState();
             }
         }
@@ -66,35 +68,35 @@ namespace Engine {
             }
         }
 
-        void Button::SetNormalColor(IColor* color) {
+        void Button::SetNormalColor(Color color) {
             m_normalTextColor = color;
         }
 
-        void Button::SetHoverColor(IColor* color) {
+        void Button::SetHoverColor(Color color) {
             m_hoverTextColor = color;
         }
 
-        void Button::SetPressedColor(IColor* color) {
+        void Button::SetPressedColor(Color color) {
             m_pressedTextColor = color;
         }
 
-        void Button::SetDisabledColor(IColor* color) {
+        void Button::SetDisabledColor(Color color) {
             m_disabledTextColor = color;
         }
 
-        void Button::SetNormalBackgroundColor(IColor* color) {
+        void Button::SetNormalBackgroundColor(Color color) {
             m_normalBackgroundColor = color;
         }
 
-        void Button::SetHoverBackgroundColor(IColor* color) {
+        void Button::SetHoverBackgroundColor(Color color) {
             m_hoverBackgroundColor = color;
         }
 
-        void Button::SetPressedBackgroundColor(IColor* color) {
+        void Button::SetPressedBackgroundColor(Color color) {
             m_pressedBackgroundColor = color;
         }
 
-        void Button::SetDisabledBackgroundColor(IColor* color) {
+        void Button::SetDisabledBackgroundColor(Color color) {
             m_disabledBackgroundColor = color;
         }
 
@@ -160,6 +162,10 @@ namespace Engine {
         }
 
         void Button::SetBounds(float x, float y, float width, float height) {
+            if (m_x != x || m_y != y || m_width != width || m_height != height) {
+                MarkDirty();
+            }
+
             m_x = x;
             m_y = y;
             m_width = width;
@@ -172,10 +178,12 @@ namespace Engine {
         }
 
         void Button::Render(IRenderingAPI& context, float x, float y) {
+            MemoryScope memoryScope(MemoryTag::UI);
+
             UpdateAppearanceForState();
             
             // Draw button background using full button bounds instead of just text bounds
-            IColor* currentBgColor = nullptr;
+            Color currentBgColor;
             switch (m_state) {
                 case ButtonState::NORMAL:
                     currentBgColor = m_normalBackgroundColor;
@@ -191,7 +199,7 @@ namespace Engine {
                     break;
             }
             
-            if (currentBgColor && currentBgColor->GetAlpha() > 0) {
+            if (currentBgColor.GetAlpha() > 0) {
                 context.DrawRect(m_x, m_y, m_width, m_height, currentBgColor);
                 
                 // Temporarily disable text background to prevent overlapping transparency
@@ -204,12 +212,14 @@ namespace Engine {
             float textY = m_y + p.top + (m_height - p.top - p.bottom - GetTextHeight()) / 2.0f;
             
             // Render text centered
-            Text::Render(context, textX, textY);
+            Rect bounds = Paint(context, textX, textY);
             
             // Re-enable text background if we disabled it
-            if (currentBgColor && currentBgColor->GetAlpha() > 0) {
+            if (currentBgColor.GetAlpha() > 0) {
                 SetBackgroundEnabled(true);
             }
+
+            UpdateBounds(bounds.Union(Rect(m_x, m_y, m_width, m_height)));
         }
 
         void Button::Render(IRenderingAPI& context, const TextAlignment& alignment) {
@@ -34,15 +34,15 @@ namespace Engine {
             bool IsEnabled() const { return m_enabled; }
 
             // Button appearance for different states
-            void SetNormalColor(IColor* color);
-            void SetHoverColor(IColor* color);
-            void SetPressedColor(IColor* color);
-            void SetDisabledColor(IColor* color);
+            void SetNormalColor(Color color);
+            void SetHoverColor(Color color);
+            void SetPressedColor(Color color);
+            void SetDisabledColor(Color color);
 
-            void SetNormalBackgroundColor(IColor* color);
-            void SetHoverBackgroundColor(IColor* color);
-            void SetPressedBackgroundColor(IColor* color);
-            void SetDisabledBackgroundColor(IColor* color);
+            void SetNormalBackgroundColor(Color color);
+            void SetHoverBackgroundColor(Color color);
+            void SetPressedBackgroundColor(Color color);
+            void SetDisabledBackgroundColor(Color color);
 
             // Mouse interaction (to be called from input system)
             void OnMouseMove(float x, float y);
@@ -87,19 +87,19 @@ namespace Engine {
             std::function<void()> m_onReleaseCallback;
 
             // State-specific colors
-            IColor* m_normalTextColor;
-            IColor* m_hoverTextColor;
-            IColor* m_pressedTextColor;
-            IColor* m_disabledTextColor;
+            Color m_normalTextColor;
+            Color m_hoverTextColor;
+            Color m_pressedTextColor;
+            Color m_disabledTextColor;
 
-            IColor* m_normalBackgroundColor;
-            IColor* m_hoverBackgroundColor;
-            IColor* m_pressedBackgroundColor;
-            IColor* m_disabledBackgroundColor;
+            Color m_normalBackgroundColor;
+            Color m_hoverBackgroundColor;
+            Color m_pressedBackgroundColor;
+            Color m_disabledBackgroundColor;
 
             // Store original colors
-            IColor* m_originalTextColor;
-            IColor* m_originalBackgroundColor;
+            Color m_originalTextColor;
+            Color m_originalBackgroundColor;
         };
     }
 }
@@ -1,4 +1,5 @@
 #include "../UI/Effect.h"
+#include "../UI/Animator.h"
 #include <cmath>
 
 namespace Engine {
@@ -14,5 +15,13 @@ namespace Engine {
                 }
             }
         }
+
+        void TextEffect::ApplyToStream(GlyphStream& glyphs, float time) {
+            for (size_t i = 0; i < glyphs.Size(); ++i) {
+                CharacterRenderState renderState = glyphs.Get(i);
+                ApplyToCharacter(renderState, glyphs.index[i], time);
+                glyphs.Set(i, renderState);
+            }
+        }
     }
 }
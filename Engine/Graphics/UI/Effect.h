@@ -2,12 +2,14 @@
 
 #include <string>
 #include <vector>
+#include <cstdint>
 
 namespace Engine {
     namespace Graphics {
         class Text;
         class IRenderingAPI;
         struct CharacterRenderState;
+        struct GlyphStream;
         
         // Base class for all text effects
         class TextEffect {
@@ -27,6 +29,9 @@ namespace Engine {
             virtual void ApplyToCharacter(CharacterRenderState& renderState, int charIndex, float time) {
                 (void)renderState; (void)charIndex; (void)time;
             }
+
+            // Apply the effect to every glyph of a text in one pass (default: ApplyToCharacter per glyph)
+            virtual void ApplyToStream(GlyphStream& glyphs, float time);
             
             // Check if effect is finished
             bool IsFinished() const { return !loop && currentTime >= (duration + startDelay); }
@@ -61,7 +66,7 @@ namespace Engine {
         
         // Helper struct for character positioning
         struct CharacterInfo {
-            char character;
+            uint32_t character;     // Unicode codepoint
             float x, y;         // Base position
             float width, height; // Character dimensions
             int index;          // Character index in string
@@ -0,0 +1,82 @@
+#include "EffectMath.h"
+#include <cmath>
+
+#if defined(__SSE2__)
+    #include <emmintrin.h>
+#endif
+
+namespace Engine {
+    namespace Graphics {
+        namespace EffectMath {
+            namespace {
+                // 2 pi split in two, the high part times small integers stays exact
+                const float TWO_PI_HIGH = 6.28125f;
+                const float TWO_PI_LOW  = 1.9353071795864769e-3f;
+                const float INV_TWO_PI  = 0.15915494309189535f;
+                const float PI          = 3.14159265358979324f;
+                const float HALF_PI     = 1.57079632679489662f;
+
+                // Taylor terms up to x^11, enough on [-pi/2, pi/2]
+                const float S3  = -1.0f / 6.0f;
+                const float S5  = 1.0f / 120.0f;
+                const float S7  = -1.0f / 5040.0f;
+                const float S9  = 1.0f / 362880.0f;
+                const float S11 = -1.0f / 39916800.0f;
+            }
+
+            float Sin(float value) {
+                // Into [-pi, pi], then sin(pi - x) = sin(x) folds it onto [-pi/2, pi/2]
+                float turns = std::nearbyint(value * INV_TWO_PI);
+                float x = (value - turns * TWO_PI_HIGH) - turns * TWO_PI_LOW;
+
+                if(x > HALF_PI) {
+                    x = PI - x;
+                } else if(x < -HALF_PI) {
+                    x = -PI - x;
+                }
+
+                float x2 = x * x;
+                return x + x * x2 * (S3 + x2 * (S5 + x2 * (S7 + x2 * (S9 + x2 * S11))));
+            }
+
+            void Sin(float* values, size_t count) {
+                size_t index = 0;
+
+#if defined(__SSE2__)
+                const __m128 signMask   = _mm_set1_ps(-0.0f);
+                const __m128 inverse    = _mm_set1_ps(INV_TWO_PI);
+                const __m128 high       = _mm_set1_ps(TWO_PI_HIGH);
+                const __m128 low        = _mm_set1_ps(TWO_PI_LOW);
+                const __m128 pi         = _mm_set1_ps(PI);
+                const __m128 halfPi     = _mm_set1_ps(HALF_PI);
+
+                for(; index + 4 <= count; index += 4) {
+                    __m128 value = _mm_loadu_ps(values + index);
+
+                    // Round to nearest like nearbyint
+                    __m128 turns = _mm_cvtepi32_ps(_mm_cvtps_epi32(_mm_mul_ps(value, inverse)));
+                    __m128 x = _mm_sub_ps(_mm_sub_ps(value, _mm_mul_ps(turns, high)), _mm_mul_ps(turns, low));
+
+                    // Beyond pi/2 either way: x = +-pi - x
+                    __m128 sign     = _mm_and_ps(x, signMask);
+                    __m128 folded   = _mm_sub_ps(_mm_or_ps(pi, sign), x);
+                    __m128 outside  = _mm_cmpgt_ps(_mm_andnot_ps(signMask, x), halfPi);
+                    x = _mm_or_ps(_mm_and_ps(outside, folded), _mm_andnot_ps(outside, x));
+
+                    __m128 x2 = _mm_mul_ps(x, x);
+                    __m128 poly = _mm_add_ps(_mm_set1_ps(S9), _mm_mul_ps(x2, _mm_set1_ps(S11)));
+                    poly = _mm_add_ps(_mm_set1_ps(S7), _mm_mul_ps(x2, poly));
+                    poly = _mm_add_ps(_mm_set1_ps(S5), _mm_mul_ps(x2, poly));
+                    poly = _mm_add_ps(_mm_set1_ps(S3), _mm_mul_ps(x2, poly));
+
+                    _mm_storeu_ps(values + index, _mm_add_ps(x, _mm_mul_ps(_mm_mul_ps(x, x2), poly)));
+                }
+#endif
+
+                for(; index < count; index++) {
+                    values[index] = Sin(values[index]);
+                }
+            }
+        }
+    }
+}
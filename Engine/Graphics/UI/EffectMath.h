@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstddef>
+
+namespace Engine {
+    namespace Graphics {
+        /*
+         * Math for text effects running over whole glyph streams. Sin replaces
+         * every value by its sine, four at a time with SSE2; the polynomial is
+         * within 1e-6 of std::sin for the phases effects produce (|x| < 1e4).
+         * The single value version gives the same results as the batch.
+         */
+        namespace EffectMath {
+            float Sin(float value);
+            void Sin(float* values, size_t count);
+        }
+    }
+}
@@ -1,12 +1,13 @@
 #include "Menu.h"
 #include "../../IRenderingAPI.h"
+#include "../../../Core/MemoryTracker.h"
 #include <iostream>
 #include <ostream>
 
 namespace Engine {
     namespace Graphics {
 
-        Menu::Menu() : backgroundColor(new RGBA(0, 0, 0, 0)), // Olive/Yellow background
+        Menu::Menu() : backgroundColor(0, 0, 0, 0), // Olive/Yellow background
                        buttonSpacing(2.0f), keyCallback(nullptr) {
         }
 
@@ -23,6 +24,8 @@ namespace Engine {
         }
 
         void Menu::Render(IRenderingAPI& context, float x, float y, float width, float height) {
+            MemoryScope memoryScope(MemoryTag::UI);
+
             size_t item_count = menuItems.size();
             float totalHeight = 0.0f;
 
@@ -55,6 +58,10 @@ namespace Engine {
             // Items rendern (von oben nach unten)
             float currentY = backgroundY;
 
+            // Items outside the clip keep their bounds for hit testing but are not drawn
+            Rect clip;
+            bool clipped = context.GetScissor(clip);
+
             for(const MenuItem& item : menuItems) {
                 if(item.type == MenuItem::BUTTON && item.button) {
                     float btnHeight = item.button->GetTextHeight();
@@ -62,7 +69,10 @@ namespace Engine {
                     btnHeight += p.top + p.bottom;
 
                     item.button->SetBounds(x, currentY, width, btnHeight);
-                    item.button->Render(context, x, currentY);
+
+                    if(!clipped || clip.Intersects(Rect(x, currentY, width, btnHeight))) {
+                        item.button->Render(context, x, currentY);
+                    }
                     
                     currentY += btnHeight + buttonSpacing;
                 } else if(item.type == MenuItem::SPACE) {
@@ -71,16 +81,25 @@ namespace Engine {
             }
         }
 
+        void Menu::CollectDamage(DamageRegion& damage) const {
+            for(const MenuItem& item : menuItems) {
+                if(item.type == MenuItem::BUTTON && item.button) {
+                    item.button->CollectDamage(damage);
+                }
+            }
+        }
+
         void Menu::AddButton(const std::string& text, const std::string& key) {
             Button* button = new Button();
             button->SetValue(text);
             button->SetFont("Sansation");
             button->SetSize(20.0f);
-            button->SetNormalColor(new RGBA(255, 255, 255, 100));
-            button->SetNormalBackgroundColor(new RGBA(0, 0, 0, 40));
-            button->SetHoverBackgroundColor(new RGBA(0, 0, 0, 20));
+            button->SetNormalColor(Color(255, 255, 255, 100));
+            button->SetNormalBackgroundColor(Color(0, 0, 0, 40));
+            button->SetHoverBackgroundColor(Color(0, 0, 0, 20));
             button->SetPadding(5.0f, 5.0f);
             button->SetMargin(0.0f, 0.0f);
+            button->SetCached(true);
             //button->SetStyle(Engine::Graphics::FontStyle::UPPERCASE);
 
             // Set click handler to trigger key callback
@@ -110,7 +129,7 @@ namespace Engine {
             keyCallback = callback;
         }
 
-        void Menu::SetBackgroundColor(IColor* color) {
+        void Menu::SetBackgroundColor(Color color) {
             backgroundColor = color;
         }
 
@@ -17,6 +17,9 @@ namespace Engine {
             void Update(float deltaTime);
             void Render(IRenderingAPI& context, float x, float y, float width, float height);
             
+            // Damage tracking
+            void CollectDamage(DamageRegion& damage) const;
+
             // Mouse event handling
             void OnMouseMove(float x, float y);
             void OnMouseDown(float x, float y);
@@ -31,7 +34,7 @@ namespace Engine {
             void OnKey(std::function<void(const std::string&)> callback);
             
             // Appearance
-            void SetBackgroundColor(IColor* color);
+            void SetBackgroundColor(Color color);
             void SetButtonSpacing(float spacing);
             
         private:
@@ -48,7 +51,7 @@ namespace Engine {
             void TriggerKey(const std::string& key);
             
             std::vector<MenuItem> menuItems;
-            IColor* backgroundColor;
+            Color backgroundColor;
             float buttonSpacing;
             std::function<void(const std::string&)> keyCallback;
         };
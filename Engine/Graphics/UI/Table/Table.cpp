@@ -1,7 +1,8 @@
 #include "Table.h"
 #include "../../IRenderingAPI.h"
-#include "../../RGBA.h"
+#include "../../../Core/MemoryTracker.h"
 #include <algorithm>
+#include <cmath>
 
 Table::Table() 
     : rowHeight(30.0f), headerHeight(35.0f), autoColumnWidths(true), showBorders(false) {
@@ -9,19 +10,18 @@ Table::Table()
 }
 
 Table::~Table() {
-    for (auto& pair : styles) {
-        delete pair.second;
-    }
+    /* Do Nothing */
 }
 
 void Table::InitializeDefaultStyles() {
-    styles[HEADER_BACKGROUND] = new Engine::Graphics::RGBA(60, 60, 80, 200);
-    styles[HEADER_TEXT_COLOR] = new Engine::Graphics::RGBA(255, 255, 255, 255);
-    styles[ROW_BACKGROUND] = new Engine::Graphics::RGBA(0, 0, 0, 127); // 50% alpha = 127
-    styles[ROW_ALT_BACKGROUND] = new Engine::Graphics::RGBA(0, 0, 0, 127); // Same as ROW_BACKGROUND for uniform color
-    styles[ROW_TEXT_COLOR] = new Engine::Graphics::RGBA(220, 220, 220, 255);
-    styles[BORDER_COLOR] = new Engine::Graphics::RGBA(100, 100, 120, 255);
-    styles[SELECTED_ROW_BACKGROUND] = new Engine::Graphics::RGBA(70, 120, 180, 200);
+    // Alpha is in percent, the old 0..255 values were clamped to opaque anyway
+    styles[HEADER_BACKGROUND] = Engine::Graphics::Color(60, 60, 80, 100);
+    styles[HEADER_TEXT_COLOR] = Engine::Graphics::Color(255, 255, 255, 100);
+    styles[ROW_BACKGROUND] = Engine::Graphics::Color(0, 0, 0, 100);
+    styles[ROW_ALT_BACKGROUND] = Engine::Graphics::Color(0, 0, 0, 100); // Same as ROW_BACKGROUND for uniform color
+    styles[ROW_TEXT_COLOR] = Engine::Graphics::Color(220, 220, 220, 100);
+    styles[BORDER_COLOR] = Engine::Graphics::Color(100, 100, 120, 100);
+    styles[SELECTED_ROW_BACKGROUND] = Engine::Graphics::Color(70, 120, 180, 100);
     
     // Initialize text styles
     textStyles[HEADER_TEXT_STYLE] = Engine::Graphics::FontStyle::BOLD;
@@ -143,12 +143,7 @@ void Table::RemoveRow(int rowIndex) {
     }
 }
 
-void Table::SetStyle(StyleProperty property, Engine::Graphics::IColor* color) {
-    // Don't delete the color - it might be managed elsewhere
-    // Only delete if it's different from the new one
-    if (styles.find(property) != styles.end() && styles[property] != color) {
-        delete styles[property];
-    }
+void Table::SetStyle(StyleProperty property, Engine::Graphics::Color color) {
     styles[property] = color;
 }
 
@@ -156,12 +151,12 @@ void Table::SetStyle(StyleProperty property, Engine::Graphics::FontStyle style)
     textStyles[property] = style;
 }
 
-Engine::Graphics::IColor* Table::GetStyle(StyleProperty property) {
+Engine::Graphics::Color Table::GetStyle(StyleProperty property) {
     auto it = styles.find(property);
     if (it != styles.end()) {
         return it->second;
     }
-    return nullptr;
+    return Engine::Graphics::Color();
 }
 
 Engine::Graphics::FontStyle Table::GetTextStyle(StyleProperty property) {
@@ -225,6 +220,7 @@ void Table::SetupTextStyle(Engine::Graphics::Text& text, bool isHeader) {
         text.SetSize(16.0f);
         text.SetColor(GetStyle(HEADER_TEXT_COLOR));
         text.SetStyle(GetTextStyle(HEADER_TEXT_STYLE));
+        text.SetCached(true);
     } else {
         text.SetSize(14.0f);
         text.SetColor(GetStyle(ROW_TEXT_COLOR));
@@ -245,6 +241,8 @@ void Table::Update(float deltaTime) {
 }
 
 void Table::Render(Engine::Graphics::IRenderingAPI& context, float x, float y, float width, float height) {
+    Engine::MemoryScope memoryScope(Engine::MemoryTag::UI);
+
     if (headers.empty()) return;
 
     CalculateColumnWidths(width);
@@ -261,6 +259,12 @@ void Table::Render(Engine::Graphics::IRenderingAPI& context, float x, float y, f
 }
 
 void Table::RenderHeaders(Engine::Graphics::IRenderingAPI& context, float x, float y, float width) {
+    // Header scrolled out of the clip
+    Engine::Graphics::Rect clip;
+    if (context.GetScissor(clip) && !clip.Intersects(Engine::Graphics::Rect(x, y, width, headerHeight))) {
+        return;
+    }
+
     // Draw header background
     context.DrawRect(x, y, width, headerHeight, GetStyle(HEADER_BACKGROUND));
 
@@ -315,10 +319,21 @@ void Table::RenderRows(Engine::Graphics::IRenderingAPI& context, float x, float
     float adjustedRowHeight = rowHeight - rowSpacing;
     int maxVisibleRows = static_cast<int>(height / rowHeight);
     int rowsToShow = std::min(maxVisibleRows, static_cast<int>(rows.size()));
+    int firstRow = 0;
 
-    for (int rowIndex = 0; rowIndex < rowsToShow; ++rowIndex) {
+    // Only rows inside the clip are built, long tables cost what is visible
+    Engine::Graphics::Rect clip;
+    bool clipped = context.GetScissor(clip);
+
+    if (clipped) {
+        firstRow = std::max(0, static_cast<int>(std::floor((clip.y - y) / rowHeight)));
+        rowsToShow = std::min(rowsToShow, static_cast<int>(std::ceil((clip.GetBottom() - y) / rowHeight)));
+        currentY = y + firstRow * rowHeight;
+    }
+
+    for (int rowIndex = firstRow; rowIndex < rowsToShow; ++rowIndex) {
         // Use uniform row background (both ROW_BACKGROUND and ROW_ALT_BACKGROUND are same now)
-        Engine::Graphics::IColor* rowBg = GetStyle(ROW_BACKGROUND);
+        Engine::Graphics::Color rowBg = GetStyle(ROW_BACKGROUND);
         
         context.DrawRect(x, currentY, width, adjustedRowHeight, rowBg);
 
@@ -328,8 +343,10 @@ void Table::RenderRows(Engine::Graphics::IRenderingAPI& context, float x, float
         for (size_t colIndex = 0; colIndex < row.size() && colIndex < columnWidths.size(); ++colIndex) {
             float columnWidth = columnWidths[colIndex];
 
-            // Render cell text with alignment
-            if (colIndex < row.size()) {
+            // Render cell text with alignment (columns outside the clip are skipped)
+            bool columnVisible = !clipped || (currentX < clip.GetRight() && currentX + columnWidth > clip.x);
+
+            if (columnVisible && colIndex < row.size()) {
                 float textY = currentY + (adjustedRowHeight - 18.0f) / 2;
                 
                 // Get alignment for this cell if available
@@ -1,5 +1,5 @@
 #pragma once
-#include "../../IColor.h"
+#include "../../Color.h"
 #include "../Text/Text.h"
 #include "../Alignment.h"
 #include <vector>
@@ -45,9 +45,9 @@ public:
     void RemoveRow(int rowIndex);
 
     // Style methods
-    void SetStyle(StyleProperty property, Engine::Graphics::IColor* color);
+    void SetStyle(StyleProperty property, Engine::Graphics::Color color);
     void SetStyle(StyleProperty property, Engine::Graphics::FontStyle style);
-    Engine::Graphics::IColor* GetStyle(StyleProperty property);
+    Engine::Graphics::Color GetStyle(StyleProperty property);
     Engine::Graphics::FontStyle GetTextStyle(StyleProperty property);
 
     // Column width methods
@@ -84,7 +84,7 @@ private:
     std::vector<HeaderInfo> headers;
     std::vector<std::vector<std::unique_ptr<Engine::Graphics::Text>>> rows;
     std::vector<std::vector<HorizontalAlignment>> rowAlignments;
-    std::map<StyleProperty, Engine::Graphics::IColor*> styles;
+    std::map<StyleProperty, Engine::Graphics::Color> styles;
     std::map<StyleProperty, Engine::Graphics::FontStyle> textStyles;
     std::vector<float> columnWidths;
     
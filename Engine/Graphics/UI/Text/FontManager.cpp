@@ -0,0 +1,266 @@
+#include "FontManager.h"
+#include <iostream>
+#include FT_ADVANCES_H
+
+namespace Engine {
+    namespace Graphics {
+        FontFace::~FontFace() {
+            // The face reads from the mapping, it goes first
+            if(face) {
+                FT_Done_Face(face);
+            }
+        }
+
+        void FontFace::SetPixelSize(unsigned int size) {
+            if(pixelSize != size) {
+                FT_Set_Pixel_Sizes(face, 0, size);
+                pixelSize = size;
+            }
+        }
+
+        const AtlasGlyph* GlyphSet::Find(uint32_t codepoint, bool* pending) const {
+            Sync();
+
+            const Entry* entry;
+
+            if(codepoint >= FIRST && codepoint <= LAST) {
+                size_t index = codepoint - FIRST;
+
+                if(!loaded[index] || ascii[index].pending) {
+                    Entry fetched = Load(codepoint);
+                    ascii[index]  = fetched;
+                    loaded[index] = true;
+                }
+
+                entry = &ascii[index];
+            } else {
+                auto it = others.find(codepoint);
+
+                if(it == others.end()) {
+                    Entry fetched = Load(codepoint);
+                    it = others.emplace(codepoint, fetched).first;
+                } else if(it->second.pending) {
+                    // Load may clear the map, the iterator is looked up again
+                    Entry fetched = Load(codepoint);
+                    it = others.insert_or_assign(codepoint, fetched).first;
+                }
+
+                entry = &it->second;
+            }
+
+            if(!entry->present) {
+                return nullptr;
+            }
+
+            if(pending && entry->pending) {
+                *pending = true;
+            }
+
+            // Keeps the page from being evicted while this frame still draws from it
+            GlyphAtlas::GetInstance().Touch(entry->glyph);
+            return &entry->glyph;
+        }
+
+        GlyphSet::Entry GlyphSet::Load(uint32_t codepoint) const {
+            Entry entry = {};
+
+            // Codepoints the font doesn't cover are remembered as missing instead of drawing .notdef
+            FT_UInt index = FT_Get_Char_Index(face->GetFace(), codepoint);
+
+            if(index == 0) {
+                return entry;
+            }
+
+            // Glyphs already in the atlas (same file, size and mode) are only looked up
+            bool pending = false;
+            const AtlasGlyph* glyph = GlyphAtlas::GetInstance().RequestGlyph(face, pixelSize, codepoint, distanceField, pending);
+
+            // Making room may have evicted glyphs copied here before, the new one stays valid
+            Sync();
+
+            if(glyph) {
+                entry.glyph   = *glyph;
+                entry.present = true;
+            } else if(pending) {
+                // Advance from the metrics tables, measuring and layout don't have to wait for the bitmap
+                FT_Fixed advance = 0;
+                face->SetPixelSize(pixelSize);
+                FT_Get_Advance(face->GetFace(), index, distanceField ? FT_LOAD_NO_HINTING : FT_LOAD_DEFAULT, &advance);
+
+                entry.glyph.advance = static_cast<unsigned int>(advance >> 16);
+                entry.present       = true;
+                entry.pending       = true;
+            }
+
+            return entry;
+        }
+
+        float GlyphSet::GetKerning(uint32_t left, uint32_t right) const {
+            FT_Face handle = face->GetFace();
+
+            if(!FT_HAS_KERNING(handle)) {
+                return 0.0f;
+            }
+
+            uint64_t pair = (static_cast<uint64_t>(left) << 32) | right;
+            auto it = kerning.find(pair);
+
+            if(it != kerning.end()) {
+                return it->second;
+            }
+
+            FT_Vector delta = {};
+            face->SetPixelSize(pixelSize);
+
+            // Distance fields are scaled, their kerning isn't rounded to whole pixels of the reference size
+            FT_Get_Kerning(handle, FT_Get_Char_Index(handle, left), FT_Get_Char_Index(handle, right), distanceField ? FT_KERNING_UNFITTED : FT_KERNING_DEFAULT, &delta);
+
+            float value = static_cast<float>(delta.x) / 64.0f;
+            kerning.emplace(pair, value);
+            return value;
+        }
+
+        float GlyphSet::GetLineHeight() const {
+            if(lineHeight <= 0.0f) {
+                face->SetPixelSize(pixelSize);
+                lineHeight = static_cast<float>(face->GetFace()->size->metrics.height) / 64.0f;
+
+                // Fonts without a sensible line gap get the usual 1.2 em
+                if(lineHeight <= 0.0f) {
+                    lineHeight = pixelSize * 1.2f;
+                }
+            }
+
+            return lineHeight;
+        }
+
+        void GlyphSet::Sync() const {
+            uint32_t current = GlyphAtlas::GetInstance().GetGeneration();
+
+            if(generation != current) {
+                loaded.fill(false);
+                others.clear();
+                generation = current;
+            }
+        }
+
+        FontManager& FontManager::GetInstance() {
+            static FontManager instance;
+            return instance;
+        }
+
+        std::shared_ptr<GlyphSet> FontManager::Acquire(const std::string& fontPath, unsigned int pixelSize, bool distanceField) {
+            requests++;
+
+            SetKey key = { fontPath, pixelSize, distanceField };
+            auto it = sets.find(key);
+
+            if(it != sets.end()) {
+                if(std::shared_ptr<GlyphSet> set = it->second.lock()) {
+                    hits++;
+                    return set;
+                }
+            }
+
+            std::shared_ptr<FontFace> face = OpenFace(fontPath);
+
+            if(!face) {
+                return nullptr;
+            }
+
+            std::shared_ptr<GlyphSet> set(new GlyphSet());
+            set->face           = face;
+            set->pixelSize      = pixelSize;
+            set->distanceField  = distanceField;
+
+            sets[key] = set;
+            return set;
+        }
+
+        FontStats FontManager::GetStats() const {
+            FontStats stats;
+            stats.loads     = loads;
+            stats.requests  = requests;
+            stats.hits      = hits;
+
+            for(const auto& [path, weak] : faces) {
+                (void) path;
+
+                if(std::shared_ptr<FontFace> face = weak.lock()) {
+                    stats.files++;
+                    stats.mappedBytes += face->GetFileSize();
+                }
+            }
+
+            for(const auto& [key, weak] : sets) {
+                (void) key;
+
+                if(!weak.expired()) {
+                    stats.glyphSets++;
+                }
+            }
+
+            return stats;
+        }
+
+        std::shared_ptr<FontFace> FontManager::OpenFace(const std::string& fontPath) {
+            auto it = faces.find(fontPath);
+
+            if(it != faces.end()) {
+                if(std::shared_ptr<FontFace> face = it->second.lock()) {
+                    return face;
+                }
+            }
+
+            std::shared_ptr<FontFace> face(new FontFace());
+            face->library   = GetLibrary();
+            face->path      = fontPath;
+
+            if(!face->library) {
+                return nullptr;
+            }
+
+            if(!face->file.Open(fontPath)) {
+                std::cerr << "[FontManager] Can't open font: " << fontPath << std::endl;
+                return nullptr;
+            }
+
+            // The face reads glyph outlines straight from the mapping
+            if(FT_New_Memory_Face(face->library.get(), face->file.GetData(), static_cast<FT_Long>(face->file.GetSize()), 0, &face->face)) {
+                std::cerr << "[FontManager] Can't parse font: " << fontPath << std::endl;
+                face->face = nullptr;
+                return nullptr;
+            }
+
+            loads++;
+            faces[fontPath] = face;
+
+            // Expired entries of closed fonts are dropped whenever a new one opens
+            for(auto entry = sets.begin(); entry != sets.end();) {
+                entry = entry->second.expired() ? sets.erase(entry) : std::next(entry);
+            }
+
+            std::cout << "[FontManager] Loaded " << fontPath << " (" << face->file.GetSize() / 1024 << " KB)" << std::endl;
+            return face;
+        }
+
+        std::shared_ptr<FT_LibraryRec_> FontManager::GetLibrary() {
+            if(std::shared_ptr<FT_LibraryRec_> current = library.lock()) {
+                return current;
+            }
+
+            FT_Library handle = nullptr;
+
+            if(FT_Init_FreeType(&handle)) {
+                std::cerr << "[FontManager] Could not initialize FreeType Library" << std::endl;
+                return nullptr;
+            }
+
+            GlyphAtlas::ConfigureLibrary(handle);
+
+            std::shared_ptr<FT_LibraryRec_> created(handle, [](FT_Library instance) { FT_Done_FreeType(instance); });
+            library = created;
+            return created;
+        }
+    }
+}
@@ -0,0 +1,152 @@
+#pragma once
+
+#include "GlyphAtlas.h"
+#include "../../../Core/MappedFile.h"
+#include <string>
+#include <memory>
+#include <unordered_map>
+#include <array>
+#include <cstdint>
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+namespace Engine {
+    namespace Graphics {
+        // One font file mapped into memory and opened once as an FT_Face
+        class FontFace {
+            public:
+                ~FontFace();
+
+                FontFace(const FontFace&) = delete;
+                FontFace& operator=(const FontFace&) = delete;
+
+                const std::string& GetPath() const { return path; }
+                FT_Face GetFace() const { return face; }
+                size_t GetFileSize() const { return file.GetSize(); }
+                const unsigned char* GetData() const { return file.GetData(); }
+
+                // Faces are shared between sizes, the size is only switched when it differs
+                void SetPixelSize(unsigned int pixelSize);
+
+            private:
+                friend class FontManager;
+                FontFace() = default;
+
+                std::shared_ptr<FT_LibraryRec_> library;    // Keeps FreeType alive until the last face is gone
+                std::string path;
+                MappedFile file;
+                FT_Face face            = nullptr;
+                unsigned int pixelSize  = 0;
+        };
+
+        /*
+         * Glyphs of one face at one pixel size (or as distance fields), shared
+         * by every Text using them. Any codepoint is rasterized into the atlas
+         * on first use; printable ASCII is kept in a flat table, the rest in a
+         * hash map. Kerning pairs are read from the font's 'kern' table. Until a worker has rasterized it, a glyph is reported as
+         * pending and only carries its advance.
+         */
+        class GlyphSet {
+            public:
+                // Glyph metrics and atlas placement, nullptr if the font has no such glyph
+                const AtlasGlyph* Find(uint32_t codepoint, bool* pending = nullptr) const;
+
+                // Pen adjustment between two codepoints in pixels at the set's size, 0 without a kerning table
+                float GetKerning(uint32_t left, uint32_t right) const;
+
+                // Baseline to baseline distance the font asks for at the set's size
+                float GetLineHeight() const;
+
+                const std::string& GetPath() const { return face->GetPath(); }
+                unsigned int GetPixelSize() const { return pixelSize; }
+                bool IsDistanceField() const { return distanceField; }
+
+                static const unsigned long FIRST = 32;
+                static const unsigned long LAST  = 126;
+
+            private:
+                friend class FontManager;
+                GlyphSet() = default;
+
+                struct Entry {
+                    AtlasGlyph glyph;
+                    bool present;
+                    bool pending;   // Queued for rasterization, asked again on every lookup
+                };
+
+                // Asks the atlas for a glyph not looked up yet
+                Entry Load(uint32_t codepoint) const;
+
+                // Forgets every lookup when the atlas evicted or cleared glyphs since the last one
+                void Sync() const;
+
+                std::shared_ptr<FontFace> face;
+                unsigned int pixelSize  = 0;
+                bool distanceField      = false;
+
+                mutable std::array<Entry, LAST - FIRST + 1> ascii;
+                mutable std::array<bool, LAST - FIRST + 1> loaded = {};
+                mutable std::unordered_map<uint32_t, Entry> others;
+                mutable uint32_t generation = 0;
+
+                // Kerning doesn't depend on the atlas, pairs stay cached for the life of the set
+                mutable std::unordered_map<uint64_t, float> kerning;
+                mutable float lineHeight = 0.0f;
+        };
+
+        struct FontStats {
+            size_t files        = 0;    // Font files currently open
+            size_t mappedBytes  = 0;
+            size_t glyphSets    = 0;    // Live (file, size, mode) sets
+            uint64_t loads      = 0;    // Files opened since start
+            uint64_t requests   = 0;
+            uint64_t hits       = 0;    // Requests served by a live glyph set
+        };
+
+        /*
+         * Process-wide font cache. Each font file is mapped and parsed once,
+         * glyph sets are shared per (file, pixel size). Both are reference
+         * counted: they close when the last Text using them lets go.
+         * Distance field sets are rasterized once at DISTANCE_FIELD_SIZE and
+         * scaled to any size when drawn.
+         */
+        class FontManager {
+            public:
+                static FontManager& GetInstance();
+
+                // Glyph set of fontPath at pixelSize, nullptr if the file can't be opened
+                std::shared_ptr<GlyphSet> Acquire(const std::string& fontPath, unsigned int pixelSize, bool distanceField = false);
+
+                static const unsigned int DISTANCE_FIELD_SIZE = 48;
+
+                FontStats GetStats() const;
+
+            private:
+                FontManager() = default;
+
+                std::shared_ptr<FontFace> OpenFace(const std::string& fontPath);
+                std::shared_ptr<FT_LibraryRec_> GetLibrary();
+
+                struct SetKey {
+                    std::string path;
+                    unsigned int size;
+                    bool distanceField;
+
+                    bool operator==(const SetKey& other) const { return size == other.size && distanceField == other.distanceField && path == other.path; }
+                };
+
+                struct SetKeyHash {
+                    size_t operator()(const SetKey& key) const { return std::hash<std::string>()(key.path) ^ (static_cast<size_t>(key.size) * 2654435761u) ^ static_cast<size_t>(key.distanceField); }
+                };
+
+                std::weak_ptr<FT_LibraryRec_> library;
+                std::unordered_map<std::string, std::weak_ptr<FontFace>> faces;
+                std::unordered_map<SetKey, std::weak_ptr<GlyphSet>, SetKeyHash> sets;
+
+                uint64_t loads      = 0;
+                uint64_t requests   = 0;
+                uint64_t hits       = 0;
+        };
+    }
+}
@@ -0,0 +1,866 @@
+#include "GlyphAtlas.h"
+#include "FontManager.h"
+#include "../../RenderStats.h"
+#include "../../../Core/Engine.h"
+#include "../../../Core/MappedFile.h"
+#include <algorithm>
+#include <iterator>
+#include <iostream>
+#include <fstream>
+#include <chrono>
+#include <cstring>
+#include FT_MODULE_H
+
+#ifdef _WIN32
+    #include <windows.h>
+    #include <gl/gl.h>
+#endif
+
+namespace Engine {
+    namespace Graphics {
+        void SkylinePacker::Reset(int pageSize) {
+            size     = pageSize;
+            usedArea = 0;
+            skyline.clear();
+
+            if(size > 0) {
+                skyline.push_back({ 0, 0, size });
+            }
+        }
+
+        void SkylinePacker::Restore(int pageSize, std::vector<Node> nodes, int64_t area) {
+            size     = pageSize;
+            usedArea = area;
+            skyline  = std::move(nodes);
+        }
+
+        int SkylinePacker::Fit(size_t index, int width, int height) const {
+            if(skyline[index].x + width > size) {
+                return -1;
+            }
+
+            int y           = skyline[index].y;
+            int remaining   = width;
+
+            for(size_t node = index; remaining > 0 && node < skyline.size(); node++) {
+                y = std::max(y, skyline[node].y);
+
+                if(y + height > size) {
+                    return -1;
+                }
+
+                remaining -= skyline[node].width;
+            }
+
+            return y;
+        }
+
+        bool SkylinePacker::Insert(int width, int height, int& x, int& y) {
+            if(width <= 0 || height <= 0) {
+                return false;
+            }
+
+            size_t bestIndex    = skyline.size();
+            int bestBottom      = size + 1;
+            int bestWidth       = size + 1;
+
+            // Lowest resulting top edge wins, ties go to the narrower segment
+            for(size_t index = 0; index < skyline.size(); index++) {
+                int top = Fit(index, width, height);
+
+                if(top < 0) {
+                    continue;
+                }
+
+                if(top + height < bestBottom || (top + height == bestBottom && skyline[index].width < bestWidth)) {
+                    bestIndex   = index;
+                    bestBottom  = top + height;
+                    bestWidth   = skyline[index].width;
+                    y           = top;
+                }
+            }
+
+            if(bestIndex == skyline.size()) {
+                return false;
+            }
+
+            x = skyline[bestIndex].x;
+            skyline.insert(skyline.begin() + bestIndex, { x, y + height, width });
+
+            // Cut the segments now covered by the new one
+            for(size_t index = bestIndex + 1; index < skyline.size();) {
+                const Node& previous = skyline[index - 1];
+                int overlap = previous.x + previous.width - skyline[index].x;
+
+                if(overlap <= 0) {
+                    break;
+                }
+
+                skyline[index].x     += overlap;
+                skyline[index].width -= overlap;
+
+                if(skyline[index].width > 0) {
+                    break;
+                }
+
+                skyline.erase(skyline.begin() + index);
+            }
+
+            // Merge neighbours at the same height
+            for(size_t index = 0; index + 1 < skyline.size();) {
+                if(skyline[index].y == skyline[index + 1].y) {
+                    skyline[index].width += skyline[index + 1].width;
+                    skyline.erase(skyline.begin() + index + 1);
+                } else {
+                    index++;
+                }
+            }
+
+            usedArea += static_cast<int64_t>(width) * height;
+            return true;
+        }
+
+        GlyphAtlas& GlyphAtlas::GetInstance() {
+            static GlyphAtlas instance;
+            return instance;
+        }
+
+        namespace {
+            const char CACHE_MAGIC[4]       = { 'G', 'A', 'T', 'L' };
+            const uint32_t CACHE_FORMAT     = 1;
+
+            // Cache file: header, fonts (path, size, hash), glyphs, then every page (skyline and pixels)
+            struct CacheHeader {
+                char magic[4];
+                uint32_t format;
+                uint32_t freetype;          // Rasterizer output may change between versions
+                uint32_t pageSize;
+                uint32_t spread;
+                uint32_t padding;
+                uint32_t fonts;
+                uint32_t glyphs;
+                uint32_t pages;
+            };
+
+            struct CacheGlyph {
+                uint32_t font;              // Index into the fonts of the file
+                uint32_t size;
+                uint32_t glyph;
+                uint32_t distanceField;
+                float u0, v0, u1, v1;
+                uint32_t width, height;
+                int32_t bearingX, bearingY;
+                uint32_t advance;
+                uint32_t spread;
+                uint32_t page;
+            };
+
+            struct CacheReader {
+                const unsigned char* data;
+                size_t size;
+                size_t offset = 0;
+
+                template<typename T>
+                bool Read(T& value) {
+                    if(size - offset < sizeof(T)) {
+                        return false;
+                    }
+
+                    std::memcpy(&value, data + offset, sizeof(T));
+                    offset += sizeof(T);
+                    return true;
+                }
+
+                const unsigned char* Skip(size_t bytes) {
+                    if(size - offset < bytes) {
+                        return nullptr;
+                    }
+
+                    const unsigned char* start = data + offset;
+                    offset += bytes;
+                    return start;
+                }
+            };
+
+            template<typename T>
+            void Write(std::ofstream& file, const T& value) {
+                file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+            }
+
+            uint32_t GetFreeTypeVersion() {
+                return (FREETYPE_MAJOR << 16) | (FREETYPE_MINOR << 8) | FREETYPE_PATCH;
+            }
+
+            // FNV-1a of the whole font file, 0 if it can't be read
+            uint64_t HashFile(const std::string& path, uint64_t& size) {
+                MappedFile file;
+
+                if(!file.Open(path)) {
+                    return 0;
+                }
+
+                uint64_t hash = 14695981039346656037ull;
+
+                for(size_t index = 0; index < file.GetSize(); index++) {
+                    hash = (hash ^ file.GetData()[index]) * 1099511628211ull;
+                }
+
+                size = file.GetSize();
+                return hash;
+            }
+
+            // FreeType objects aren't thread safe, every worker rasterizes with its own library
+            struct ThreadLibrary {
+                FT_Library library = nullptr;
+
+                ThreadLibrary() {
+                    if(FT_Init_FreeType(&library)) {
+                        library = nullptr;
+                        return;
+                    }
+
+                    GlyphAtlas::ConfigureLibrary(library);
+                }
+
+                ~ThreadLibrary() {
+                    if(library) {
+                        FT_Done_FreeType(library);
+                    }
+                }
+            };
+        }
+
+        void GlyphAtlas::ConfigureLibrary(FT_Library library) {
+            // Range of the distance fields, reported with every glyph
+            FT_Int spread = SPREAD;
+            FT_Property_Set(library, "sdf", "spread", &spread);
+            FT_Property_Set(library, "bsdf", "spread", &spread);
+        }
+
+        const AtlasGlyph* GlyphAtlas::GetGlyph(FT_Face face, const std::string& fontPath, unsigned int pixelSize, unsigned long charCode, bool distanceField) {
+            if(!face) {
+                return nullptr;
+            }
+
+            Key key = { GetFontId(fontPath), pixelSize, FT_Get_Char_Index(face, charCode), distanceField };
+            auto it = glyphs.find(key);
+
+            if(it != glyphs.end()) {
+                Touch(it->second);
+                return &it->second;
+            }
+
+            Bitmap bitmap;
+            bitmap.key = key;
+
+            if(!Rasterize(face, key.glyph, distanceField, bitmap)) {
+                return nullptr;
+            }
+
+            return Insert(bitmap);
+        }
+
+        const AtlasGlyph* GlyphAtlas::RequestGlyph(const std::shared_ptr<FontFace>& face, unsigned int pixelSize, unsigned long charCode, bool distanceField, bool& pending) {
+            pending = false;
+
+            if(!face || !face->GetFace()) {
+                return nullptr;
+            }
+
+            Key key = { GetFontId(face->GetPath()), pixelSize, FT_Get_Char_Index(face->GetFace(), charCode), distanceField };
+            auto it = glyphs.find(key);
+
+            if(it != glyphs.end()) {
+                Touch(it->second);
+                return &it->second;
+            }
+
+            if(failed.count(key)) {
+                return nullptr;
+            }
+
+            // No workers before the engine starts or after it stopped
+            if(!::Engine::Engine::GetInstance().IsInitialized()) {
+                face->SetPixelSize(pixelSize);
+                return GetGlyph(face->GetFace(), face->GetPath(), pixelSize, charCode, distanceField);
+            }
+
+            pending = true;
+
+            if(!inFlight.insert(key).second) {
+                return nullptr;
+            }
+
+            // Batches are capped so a long new string spreads over several workers
+            for(Batch& batch : batches) {
+                if(batch.face == face && batch.pixelSize == pixelSize && batch.distanceField == distanceField && batch.keys.size() < BATCH_GLYPHS) {
+                    batch.keys.push_back(key);
+                    return nullptr;
+                }
+            }
+
+            batches.push_back({ face, pixelSize, distanceField, { key } });
+            return nullptr;
+        }
+
+        void GlyphAtlas::BeginFrame() {
+            GlyphAtlas& atlas = GetInstance();
+            atlas.Dispatch();
+            atlas.Upload(UPLOAD_BUDGET);
+        }
+
+        void GlyphAtlas::EndFrame() {
+            GlyphAtlas& atlas = GetInstance();
+            atlas.Dispatch();
+            atlas.frame++;
+        }
+
+        void GlyphAtlas::Dispatch() {
+            for(Batch& batch : batches) {
+                Job job = { nextJob++, batch.face->GetData(), batch.face->GetFileSize(), batch.pixelSize, batch.distanceField, std::move(batch.keys) };
+
+                // Keeps the file mapped until Upload has seen the job finish
+                running[job.id] = std::move(batch.face);
+
+                auto task = [this, job]() {
+                    std::vector<Bitmap> bitmaps;
+                    RasterizeBatch(job, bitmaps);
+
+                    std::lock_guard<std::mutex> lock(finishedMutex);
+                    finished.insert(finished.end(), std::make_move_iterator(bitmaps.begin()), std::make_move_iterator(bitmaps.end()));
+                    done.push_back(job.id);
+                };
+
+                try {
+                    ::Engine::Engine::GetInstance().GetThreadPool().Enqueue(task);
+                } catch(const std::exception&) {
+                    // Pool already stopped (shutdown), rasterize on this thread
+                    task();
+                }
+            }
+
+            batches.clear();
+        }
+
+        void GlyphAtlas::RasterizeBatch(const Job& job, std::vector<Bitmap>& bitmaps) {
+            thread_local ThreadLibrary thread;
+
+            // Own face over the shared mapping, the render thread keeps the file mapped until the job is done
+            FT_Face face = nullptr;
+
+            if(thread.library && FT_New_Memory_Face(thread.library, job.data, static_cast<FT_Long>(job.size), 0, &face)) {
+                face = nullptr;
+            }
+
+            if(face) {
+                FT_Set_Pixel_Sizes(face, 0, job.pixelSize);
+            }
+
+            bitmaps.reserve(job.keys.size());
+
+            for(const Key& key : job.keys) {
+                Bitmap bitmap;
+                bitmap.key = key;
+
+                if(!face || !Rasterize(face, key.glyph, job.distanceField, bitmap)) {
+                    bitmap.valid = false;
+                }
+
+                bitmaps.push_back(std::move(bitmap));
+            }
+
+            if(face) {
+                FT_Done_Face(face);
+            }
+        }
+
+        void GlyphAtlas::Upload(size_t budgetBytes) {
+            std::vector<Bitmap> ready;
+            std::vector<uint64_t> jobs;
+
+            {
+                std::lock_guard<std::mutex> lock(finishedMutex);
+                jobs.swap(done);
+                size_t count = 0;
+                size_t bytes = 0;
+
+                // At least one glyph per frame, however large
+                while(count < finished.size() && (count == 0 || bytes + finished[count].pixels.size() <= budgetBytes)) {
+                    bytes += finished[count].pixels.size();
+                    count++;
+                }
+
+                ready.assign(std::make_move_iterator(finished.begin()), std::make_move_iterator(finished.begin() + count));
+                finished.erase(finished.begin(), finished.begin() + count);
+            }
+
+            // Their bitmaps are copied out, the faces may go (outside the lock, on this thread)
+            for(uint64_t job : jobs) {
+                running.erase(job);
+            }
+
+            for(const Bitmap& bitmap : ready) {
+                inFlight.erase(bitmap.key);
+
+                if(!bitmap.valid) {
+                    failed.insert(bitmap.key);
+                } else if(glyphs.find(bitmap.key) == glyphs.end()) {
+                    Insert(bitmap);
+                }
+
+                // Failed glyphs count as well, layouts waiting for them stop waiting
+                uploaded++;
+            }
+        }
+
+        bool GlyphAtlas::Rasterize(FT_Face face, uint32_t glyph, bool distanceField, Bitmap& bitmap) {
+            if(distanceField) {
+                // Unhinted outline, hinting is tied to the reference size and would distort other scales
+                if(FT_Load_Glyph(face, glyph, FT_LOAD_NO_HINTING) || FT_Render_Glyph(face->glyph, FT_RENDER_MODE_SDF)) {
+                    return false;
+                }
+            } else if(FT_Load_Glyph(face, glyph, FT_LOAD_RENDER)) {
+                return false;
+            }
+
+            FT_GlyphSlot slot   = face->glyph;
+            FT_Bitmap& source   = slot->bitmap;
+
+            bitmap.valid    = true;
+            bitmap.width    = source.width;
+            bitmap.height   = source.rows;
+            bitmap.bearingX = slot->bitmap_left;
+            bitmap.bearingY = slot->bitmap_top;
+            bitmap.advance  = static_cast<unsigned int>(slot->advance.x >> 6);
+
+            // FreeType rows may be padded, the upload needs them tightly packed
+            bitmap.pixels.resize(static_cast<size_t>(source.width) * source.rows);
+
+            for(unsigned int row = 0; row < source.rows; row++) {
+                std::copy(source.buffer + row * source.pitch, source.buffer + row * source.pitch + source.width, bitmap.pixels.begin() + row * source.width);
+            }
+
+            return true;
+        }
+
+        const AtlasGlyph* GlyphAtlas::Insert(const Bitmap& bitmap) {
+            AtlasGlyph glyph = {};
+            glyph.width     = bitmap.width;
+            glyph.height    = bitmap.height;
+            glyph.bearingX  = bitmap.bearingX;
+            glyph.bearingY  = bitmap.bearingY;
+            glyph.advance   = bitmap.advance;
+            glyph.spread    = bitmap.key.distanceField && bitmap.width > 0 ? SPREAD : 0;
+
+            // Empty glyphs (space) only carry their metrics
+            if(bitmap.width > 0 && bitmap.height > 0) {
+                uint32_t page = 0;
+                int x = 0;
+                int y = 0;
+
+                if(!Allocate(bitmap.width + PADDING, bitmap.height + PADDING, page, x, y)) {
+                    std::cout << "[GlyphAtlas] Glyph " << bitmap.key.glyph << " (" << bitmap.width << "x" << bitmap.height << ") doesn't fit a page" << std::endl;
+                    return nullptr;
+                }
+
+                glBindTexture(GL_TEXTURE_2D, pages[page].texture);
+                glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+                glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, bitmap.width, bitmap.height, GL_ALPHA, GL_UNSIGNED_BYTE, bitmap.pixels.data());
+                glBindTexture(GL_TEXTURE_2D, 0);
+
+                RenderStats& stats = RenderStats::GetInstance();
+                stats.AddTextureBind();
+                stats.AddUpload(bitmap.pixels.size());
+
+                const float scale = 1.0f / PAGE_SIZE;
+                glyph.texture   = pages[page].texture;
+                glyph.page      = page;
+                glyph.u0        = x * scale;
+                glyph.v0        = y * scale;
+                glyph.u1        = (x + bitmap.width) * scale;
+                glyph.v1        = (y + bitmap.height) * scale;
+
+                Touch(glyph);
+            }
+
+            changed = true;
+
+            return &glyphs.emplace(bitmap.key, glyph).first->second;
+        }
+
+        void GlyphAtlas::Clear() {
+            for(Page& page : pages) {
+                glDeleteTextures(1, &page.texture);
+            }
+
+            pages.clear();
+            glyphs.clear();
+            generation++;
+            changed = true;
+        }
+
+        bool GlyphAtlas::Load(const std::string& path) {
+            if(!pages.empty() || !glyphs.empty()) {
+                return false;
+            }
+
+            auto start = std::chrono::steady_clock::now();
+            MappedFile file;
+
+            if(!file.Open(path)) {
+                return false;
+            }
+
+            CacheReader reader = { file.GetData(), file.GetSize() };
+            CacheHeader header;
+
+            if(!reader.Read(header) || std::memcmp(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC)) != 0 || header.format != CACHE_FORMAT) {
+                std::cout << "[GlyphAtlas] Cache " << path << " is damaged or outdated, ignored" << std::endl;
+                return false;
+            }
+
+            if(header.freetype != GetFreeTypeVersion() || header.pageSize != PAGE_SIZE || header.spread != SPREAD || header.padding != PADDING) {
+                std::cout << "[GlyphAtlas] Cache " << path << " was made by another FreeType version or atlas layout, ignored" << std::endl;
+                return false;
+            }
+
+            // Fonts whose file changed since keep their glyphs out of the atlas
+            std::vector<uint32_t> fontIds(header.fonts, UINT32_MAX);
+            size_t staleFonts = 0;
+
+            for(uint32_t index = 0; index < header.fonts; index++) {
+                uint32_t length = 0;
+                uint64_t size = 0;
+                uint64_t hash = 0;
+                const unsigned char* name = reader.Read(length) ? reader.Skip(length) : nullptr;
+
+                if(!name || !reader.Read(size) || !reader.Read(hash)) {
+                    std::cout << "[GlyphAtlas] Cache " << path << " is damaged, ignored" << std::endl;
+                    return false;
+                }
+
+                std::string fontPath(reinterpret_cast<const char*>(name), length);
+                uint64_t currentSize = 0;
+
+                if(HashFile(fontPath, currentSize) == hash && currentSize == size) {
+                    fontIds[index] = GetFontId(fontPath);
+                } else {
+                    staleFonts++;
+                }
+            }
+
+            std::vector<CacheGlyph> records(header.glyphs);
+
+            for(CacheGlyph& record : records) {
+                if(!reader.Read(record)) {
+                    std::cout << "[GlyphAtlas] Cache " << path << " is damaged, ignored" << std::endl;
+                    return false;
+                }
+            }
+
+            // Everything is checked before the first upload, a damaged file leaves the atlas empty
+            struct CachedPage {
+                std::vector<SkylinePacker::Node> skyline;
+                int64_t usedArea;
+                const unsigned char* pixels;
+            };
+
+            std::vector<CachedPage> cachedPages(header.pages);
+
+            for(CachedPage& page : cachedPages) {
+                uint32_t nodes = 0;
+
+                if(!reader.Read(nodes) || !reader.Read(page.usedArea) || nodes > static_cast<uint32_t>(PAGE_SIZE)) {
+                    std::cout << "[GlyphAtlas] Cache " << path << " is damaged, ignored" << std::endl;
+                    return false;
+                }
+
+                page.skyline.resize(nodes);
+
+                for(SkylinePacker::Node& node : page.skyline) {
+                    if(!reader.Read(node)) {
+                        std::cout << "[GlyphAtlas] Cache " << path << " is damaged, ignored" << std::endl;
+                        return false;
+                    }
+                }
+
+                page.pixels = reader.Skip(PAGE_BYTES);
+
+                if(!page.pixels) {
+                    std::cout << "[GlyphAtlas] Cache " << path << " is damaged, ignored" << std::endl;
+                    return false;
+                }
+            }
+
+            // Pages go up straight from the mapping, nothing is rasterized
+            for(CachedPage& page : cachedPages) {
+                uint32_t index = AddPage(page.pixels);
+                pages[index].packer.Restore(PAGE_SIZE, std::move(page.skyline), page.usedArea);
+            }
+
+            size_t loaded = 0;
+
+            for(const CacheGlyph& record : records) {
+                if(record.font >= fontIds.size() || fontIds[record.font] == UINT32_MAX || record.page >= pages.size()) {
+                    continue;
+                }
+
+                AtlasGlyph glyph = {};
+                glyph.texture   = record.width > 0 && record.height > 0 ? pages[record.page].texture : 0;
+                glyph.u0        = record.u0;
+                glyph.v0        = record.v0;
+                glyph.u1        = record.u1;
+                glyph.v1        = record.v1;
+                glyph.width     = record.width;
+                glyph.height    = record.height;
+                glyph.bearingX  = record.bearingX;
+                glyph.bearingY  = record.bearingY;
+                glyph.advance   = record.advance;
+                glyph.spread    = record.spread;
+                glyph.page      = record.page;
+
+                Key key = { fontIds[record.font], record.size, record.glyph, record.distanceField != 0 };
+                glyphs.emplace(key, glyph);
+                loaded++;
+            }
+
+            cached  = true;
+            changed = false;
+
+            std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+            std::cout << "[GlyphAtlas] Loaded " << loaded << " glyphs in " << pages.size() << " pages from " << path
+                      << " (" << elapsed.count() << " ms" << (staleFonts > 0 ? ", " + std::to_string(staleFonts) + " changed fonts dropped" : "") << ")" << std::endl;
+
+            return true;
+        }
+
+        bool GlyphAtlas::Save(const std::string& path) {
+            if(!changed || pages.empty()) {
+                return true;
+            }
+
+            std::vector<std::string> paths(fonts.size());
+
+            for(const auto& [fontPath, id] : fonts) {
+                paths[id] = fontPath;
+            }
+
+            // Font files are identified by their contents, a font that can't be read any more isn't saved
+            struct CacheFont {
+                std::string path;
+                uint64_t size;
+                uint64_t hash;
+            };
+
+            std::vector<CacheFont> cacheFonts;
+            std::vector<int64_t> fontIndex(fonts.size(), -1);
+            std::vector<CacheGlyph> records;
+            records.reserve(glyphs.size());
+
+            for(const auto& [key, glyph] : glyphs) {
+                if(fontIndex[key.font] == -1) {
+                    uint64_t size = 0;
+                    uint64_t hash = HashFile(paths[key.font], size);
+
+                    if(hash != 0) {
+                        fontIndex[key.font] = static_cast<int64_t>(cacheFonts.size());
+                        cacheFonts.push_back({ paths[key.font], size, hash });
+                    } else {
+                        fontIndex[key.font] = -2;
+                    }
+                }
+
+                if(fontIndex[key.font] < 0) {
+                    continue;
+                }
+
+                CacheGlyph record = {};
+                record.font             = static_cast<uint32_t>(fontIndex[key.font]);
+                record.size             = key.size;
+                record.glyph            = key.glyph;
+                record.distanceField    = key.distanceField ? 1 : 0;
+                record.u0               = glyph.u0;
+                record.v0               = glyph.v0;
+                record.u1               = glyph.u1;
+                record.v1               = glyph.v1;
+                record.width            = glyph.width;
+                record.height           = glyph.height;
+                record.bearingX         = glyph.bearingX;
+                record.bearingY         = glyph.bearingY;
+                record.advance          = glyph.advance;
+                record.spread           = glyph.spread;
+                record.page             = glyph.page;
+                records.push_back(record);
+            }
+
+            std::ofstream file(path, std::ios::binary | std::ios::trunc);
+
+            if(!file) {
+                std::cout << "[GlyphAtlas] Can't write " << path << std::endl;
+                return false;
+            }
+
+            CacheHeader header = {};
+            std::memcpy(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC));
+            header.format   = CACHE_FORMAT;
+            header.freetype = GetFreeTypeVersion();
+            header.pageSize = PAGE_SIZE;
+            header.spread   = SPREAD;
+            header.padding  = PADDING;
+            header.fonts    = static_cast<uint32_t>(cacheFonts.size());
+            header.glyphs   = static_cast<uint32_t>(records.size());
+            header.pages    = static_cast<uint32_t>(pages.size());
+            Write(file, header);
+
+            for(const CacheFont& font : cacheFonts) {
+                Write(file, static_cast<uint32_t>(font.path.size()));
+                file.write(font.path.data(), font.path.size());
+                Write(file, font.size);
+                Write(file, font.hash);
+            }
+
+            file.write(reinterpret_cast<const char*>(records.data()), records.size() * sizeof(CacheGlyph));
+
+            // Pages only live on the GPU, they are read back once here
+            std::vector<unsigned char> pixels(PAGE_BYTES);
+
+            for(const Page& page : pages) {
+                const std::vector<SkylinePacker::Node>& skyline = page.packer.GetSkyline();
+
+                glBindTexture(GL_TEXTURE_2D, page.texture);
+                glPixelStorei(GL_PACK_ALIGNMENT, 1);
+                glGetTexImage(GL_TEXTURE_2D, 0, GL_ALPHA, GL_UNSIGNED_BYTE, pixels.data());
+                glBindTexture(GL_TEXTURE_2D, 0);
+
+                Write(file, static_cast<uint32_t>(skyline.size()));
+                Write(file, page.packer.GetUsedArea());
+                file.write(reinterpret_cast<const char*>(skyline.data()), skyline.size() * sizeof(SkylinePacker::Node));
+                file.write(reinterpret_cast<const char*>(pixels.data()), pixels.size());
+            }
+
+            if(!file.good()) {
+                std::cout << "[GlyphAtlas] Can't write " << path << std::endl;
+                return false;
+            }
+
+            changed = false;
+            std::cout << "[GlyphAtlas] Saved " << records.size() << " glyphs in " << pages.size() << " pages to " << path << std::endl;
+            return true;
+        }
+
+        uint32_t GlyphAtlas::GetFontId(const std::string& fontPath) {
+            auto it = fonts.find(fontPath);
+
+            if(it != fonts.end()) {
+                return it->second;
+            }
+
+            uint32_t id = static_cast<uint32_t>(fonts.size());
+            fonts[fontPath] = id;
+            return id;
+        }
+
+        bool GlyphAtlas::Allocate(int width, int height, uint32_t& page, int& x, int& y) {
+            for(uint32_t index = 0; index < pages.size(); index++) {
+                if(pages[index].packer.Insert(width, height, x, y)) {
+                    page = index;
+                    return true;
+                }
+            }
+
+            // Over budget the coldest page is reused, a new page only if all of them are in use this frame
+            if(pages.empty() || (pages.size() + 1) * PAGE_BYTES <= budget || !Evict(page)) {
+                page = AddPage();
+            }
+
+            return pages[page].packer.Insert(width, height, x, y);
+        }
+
+        bool GlyphAtlas::Evict(uint32_t& page) {
+            size_t coldest = pages.size();
+
+            for(size_t index = 0; index < pages.size(); index++) {
+                if(pages[index].lastUsed < frame && (coldest == pages.size() || pages[index].lastUsed < pages[coldest].lastUsed)) {
+                    coldest = index;
+                }
+            }
+
+            if(coldest == pages.size()) {
+                return false;
+            }
+
+            size_t evicted = 0;
+
+            for(auto it = glyphs.begin(); it != glyphs.end();) {
+                if(it->second.texture != 0 && it->second.page == coldest) {
+                    it = glyphs.erase(it);
+                    evicted++;
+                } else {
+                    ++it;
+                }
+            }
+
+            // Leftovers of the old glyphs would bleed into the padding of the new ones
+            std::vector<unsigned char> empty(PAGE_BYTES, 0);
+
+            glBindTexture(GL_TEXTURE_2D, pages[coldest].texture);
+            glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+            glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, PAGE_SIZE, PAGE_SIZE, GL_ALPHA, GL_UNSIGNED_BYTE, empty.data());
+            glBindTexture(GL_TEXTURE_2D, 0);
+
+            RenderStats& stats = RenderStats::GetInstance();
+            stats.AddTextureBind();
+            stats.AddUpload(empty.size());
+
+            pages[coldest].packer.Reset(PAGE_SIZE);
+            pages[coldest].lastUsed = frame;
+            changed = true;
+
+            // Glyph sets holding copies of the evicted glyphs look them up again
+            generation++;
+            evictions++;
+
+            std::cout << "[GlyphAtlas] Page " << coldest + 1 << " evicted (" << evicted << " glyphs)" << std::endl;
+
+            page = static_cast<uint32_t>(coldest);
+            return true;
+        }
+
+        uint32_t GlyphAtlas::AddPage(const unsigned char* pixels) {
+            Page page;
+            page.texture  = 0;
+            page.lastUsed = frame;
+            page.packer.Reset(PAGE_SIZE);
+
+            std::vector<unsigned char> empty;
+
+            if(!pixels) {
+                empty.assign(PAGE_BYTES, 0);
+                pixels = empty.data();
+            }
+
+            glGenTextures(1, &page.texture);
+            glBindTexture(GL_TEXTURE_2D, page.texture);
+            glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+            glTexImage2D(GL_TEXTURE_2D, 0, GL_ALPHA, PAGE_SIZE, PAGE_SIZE, 0, GL_ALPHA, GL_UNSIGNED_BYTE, pixels);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP);
+            glBindTexture(GL_TEXTURE_2D, 0);
+
+            RenderStats& stats = RenderStats::GetInstance();
+            stats.AddTextureBind();
+            stats.AddUpload(PAGE_BYTES);
+
+            pages.push_back(page);
+            std::cout << "[GlyphAtlas] Page " << pages.size() << " created (" << PAGE_SIZE << "x" << PAGE_SIZE << ")" << std::endl;
+
+            if(pages.size() * PAGE_BYTES > budget) {
+                std::cout << "[GlyphAtlas] Over budget: every page is in use this frame" << std::endl;
+            }
+
+            return static_cast<uint32_t>(pages.size() - 1);
+        }
+    }
+}
@@ -0,0 +1,237 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
+#include <memory>
+#include <mutex>
+#include <cstdint>
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+namespace Engine {
+    namespace Graphics {
+        class FontFace;
+
+        // Bottom-left skyline packing of rectangles into one square page
+        class SkylinePacker {
+            public:
+                struct Node {
+                    int32_t x;
+                    int32_t y;
+                    int32_t width;
+                };
+
+                explicit SkylinePacker(int size = 0) { Reset(size); }
+
+                void Reset(int size);
+
+                // Packing state of a page read back from the atlas cache
+                void Restore(int size, std::vector<Node> nodes, int64_t usedArea);
+                const std::vector<Node>& GetSkyline() const { return skyline; }
+                int64_t GetUsedArea() const { return usedArea; }
+
+                // Top-left corner of a free width x height area, false if the page is full
+                bool Insert(int width, int height, int& x, int& y);
+
+                float GetOccupancy() const { return size > 0 ? static_cast<float>(usedArea) / (static_cast<float>(size) * size) : 0.0f; }
+
+            private:
+                // Lowest y at which width fits when starting at node index, -1 if it runs off the page
+                int Fit(size_t index, int width, int height) const;
+
+                std::vector<Node> skyline;
+                int size        = 0;
+                int64_t usedArea = 0;
+        };
+
+        // Placement of one rasterized glyph in an atlas page
+        struct AtlasGlyph {
+            unsigned int texture;               // Page texture, 0 for empty glyphs (space)
+            float u0, v0, u1, v1;               // v0 is the top row
+            unsigned int width, height;
+            int bearingX, bearingY;
+            unsigned int advance;
+            unsigned int spread;                // Distance field margin around the outline on every side, 0 for coverage glyphs
+            uint32_t page;                      // Page index for GlyphAtlas::Touch
+        };
+
+        /*
+         * Glyphs of every Text packed into shared alpha texture pages. Glyphs
+         * are keyed by (font, pixel size, glyph index), so texts using the same
+         * font and size share their glyphs and draw from the same texture.
+         * Distance field glyphs share the pages with coverage glyphs; their
+         * alpha is the distance to the outline (0.5 on the edge), so one
+         * rasterization serves every scale.
+         *
+         * Pages are limited by a memory budget. When it is reached, the page
+         * least recently touched is emptied and refilled; pages touched in the
+         * current frame are never evicted, their quads may still be queued.
+         *
+         * RequestGlyph rasterizes on the thread pool, each worker with its own
+         * FreeType library and face. Finished bitmaps are packed and uploaded
+         * in BeginFrame, a limited amount per frame.
+         *
+         * Save writes the pages and glyph metrics to a cache file, Load maps it
+         * at the next start and uploads the pages as they are. Glyphs of a font
+         * file whose contents changed are dropped, the whole cache when the
+         * FreeType version or the atlas layout differ.
+         * Needs the GL context current; pages live as long as the context.
+         */
+        class GlyphAtlas {
+            public:
+                static GlyphAtlas& GetInstance();
+
+                // Glyph of charCode rasterized with face at pixelSize (the face must be set to that size)
+                const AtlasGlyph* GetGlyph(FT_Face face, const std::string& fontPath, unsigned int pixelSize, unsigned long charCode, bool distanceField = false);
+
+                // Same without rasterizing on this thread: a glyph not in the atlas yet is queued for the
+                // workers and nullptr returned with pending set. Rasterizes right away without a thread pool.
+                const AtlasGlyph* RequestGlyph(const std::shared_ptr<FontFace>& face, unsigned int pixelSize, unsigned long charCode, bool distanceField, bool& pending);
+
+                // Render thread, before drawing: uploads finished glyphs (up to UPLOAD_BUDGET bytes)
+                static void BeginFrame();
+
+                // Sets the distance field spread on a FreeType library
+                static void ConfigureLibrary(FT_Library library);
+
+                // Deletes every page, glyphs are rasterized again on next use
+                void Clear();
+
+                // Atlas cache; Load only fills an empty atlas, Save skips writing when nothing changed since
+                bool Load(const std::string& path);
+                bool Save(const std::string& path);
+                bool IsLoadedFromCache() const { return cached; }
+
+                // Marks the page of a glyph handed out earlier as used in this frame
+                void Touch(const AtlasGlyph& glyph) {
+                    if(glyph.texture != 0 && glyph.page < pages.size()) {
+                        pages[glyph.page].lastUsed = frame;
+                    }
+                }
+
+                // Hands the requests of this frame to the workers; pages untouched since an earlier frame become eviction candidates
+                static void EndFrame();
+
+                // Texture memory the pages may use before cold ones are evicted (at least one page)
+                void SetBudget(size_t bytes) { budget = bytes; }
+                size_t GetBudget() const { return budget; }
+
+                // Changes whenever glyphs handed out before became invalid
+                uint32_t GetGeneration() const { return generation; }
+
+                // Glyphs added by BeginFrame so far, layouts waiting for glyphs compare it
+                uint64_t GetUploadCount() const { return uploaded; }
+                size_t GetPendingCount() const { return inFlight.size(); }
+
+                size_t GetPageCount() const { return pages.size(); }
+                size_t GetGlyphCount() const { return glyphs.size(); }
+                uint64_t GetEvictions() const { return evictions; }
+
+                static const int PAGE_SIZE  = 512;
+                static const int PADDING    = 1;    // Empty texels between glyphs so linear filtering doesn't bleed
+                static const int SPREAD     = 6;    // Distance field range in texels, set on the FreeType library by FontManager
+                static const size_t PAGE_BYTES = static_cast<size_t>(PAGE_SIZE) * PAGE_SIZE;
+                static const size_t UPLOAD_BUDGET = 256 * 1024;
+                static const size_t BATCH_GLYPHS  = 8;     // Glyphs per worker task
+
+            private:
+                struct Key {
+                    uint32_t font;
+                    uint32_t size;
+                    uint32_t glyph;
+                    bool distanceField;
+
+                    bool operator==(const Key& other) const {
+                        return font == other.font && size == other.size && glyph == other.glyph && distanceField == other.distanceField;
+                    }
+                };
+
+                struct KeyHash {
+                    size_t operator()(const Key& key) const {
+                        return (static_cast<size_t>(key.font) * 73856093u) ^ (static_cast<size_t>(key.size) * 19349663u) ^ (static_cast<size_t>(key.glyph) * 83492791u) ^ static_cast<size_t>(key.distanceField);
+                    }
+                };
+
+                struct Page {
+                    unsigned int texture;
+                    SkylinePacker packer;
+                    uint64_t lastUsed;
+                };
+
+                // Rasterized glyph with tightly packed rows, not in a page yet
+                struct Bitmap {
+                    Key key;
+                    bool valid;
+                    unsigned int width, height;
+                    int bearingX, bearingY;
+                    unsigned int advance;
+                    std::vector<unsigned char> pixels;
+                };
+
+                // Requests of one font, size and mode, rasterized by one worker task
+                struct Batch {
+                    std::shared_ptr<FontFace> face;
+                    unsigned int pixelSize;
+                    bool distanceField;
+                    std::vector<Key> keys;
+                };
+
+                // What a worker gets of a batch: the font file only, the face stays with the render thread
+                struct Job {
+                    uint64_t id;
+                    const unsigned char* data;
+                    size_t size;
+                    unsigned int pixelSize;
+                    bool distanceField;
+                    std::vector<Key> keys;
+                };
+
+                GlyphAtlas() = default;
+
+                static bool Rasterize(FT_Face face, uint32_t glyph, bool distanceField, Bitmap& bitmap);
+                static void RasterizeBatch(const Job& job, std::vector<Bitmap>& bitmaps);
+
+                // Packs and uploads a rasterized glyph, nullptr if it doesn't fit a page
+                const AtlasGlyph* Insert(const Bitmap& bitmap);
+                void Dispatch();
+                void Upload(size_t budgetBytes);
+
+                uint32_t GetFontId(const std::string& fontPath);
+                bool Allocate(int width, int height, uint32_t& page, int& x, int& y);
+                // New page holding pixels (PAGE_BYTES), empty without
+                uint32_t AddPage(const unsigned char* pixels = nullptr);
+
+                // Empties the least recently used page, false if every page was used in this frame
+                bool Evict(uint32_t& page);
+
+                std::unordered_map<std::string, uint32_t> fonts;
+                std::unordered_map<Key, AtlasGlyph, KeyHash> glyphs;
+                std::vector<Page> pages;
+                uint32_t generation = 0;
+                uint64_t frame      = 0;
+                uint64_t evictions  = 0;
+                size_t budget       = 16 * PAGE_BYTES;
+                bool cached         = false;
+                bool changed        = false;    // Pages differ from the cache file
+
+                // Render thread: queued and in-flight requests
+                std::vector<Batch> batches;
+                std::unordered_set<Key, KeyHash> inFlight;
+                std::unordered_set<Key, KeyHash> failed;    // FreeType couldn't render them, not requested again
+                uint64_t uploaded   = 0;
+
+                // Faces of the jobs still running, released here once the job is done: dropping the
+                // last reference frees the FT_Face, which only the render thread may do
+                std::unordered_map<uint64_t, std::shared_ptr<FontFace>> running;
+                uint64_t nextJob    = 0;
+
+                // Filled by the workers
+                std::mutex finishedMutex;
+                std::vector<Bitmap> finished;
+                std::vector<uint64_t> done;
+        };
+    }
+}
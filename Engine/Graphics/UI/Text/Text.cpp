@@ -1,11 +1,16 @@
 #include "Text.h"
 #include "../../IRenderingAPI.h"
-#include "../../IColor.h"
+#include "../../Color.h"
+#include "../../RenderStats.h"
+#include "../../../Core/MemoryTracker.h"
+#include "Utf8.h"
+#include "TextSpriteCache.h"
 #include "../Core/Engine.h"
 #include <iostream>
-#include <stdexcept>
 #include <algorithm>
 #include <cctype>
+#include <cmath>
+#include <chrono>
 
 namespace Engine {
     namespace Graphics {
@@ -20,195 +25,118 @@ namespace Engine {
         const TextAlignment TextAlignment::BOTTOM_CENTER(HorizontalAlignment::CENTER, VerticalAlignment::BOTTOM);
         const TextAlignment TextAlignment::BOTTOM_RIGHT(HorizontalAlignment::RIGHT, VerticalAlignment::BOTTOM);
 
-        bool Text::s_initialized = false;
-        FT_Library Text::s_library;
-        int Text::s_instanceCount = 0;
-
-        Text::Text() : m_face(nullptr), m_fontSize(14), m_texturesGenerated(false),
-                       m_text(""), m_fontName(""), m_textColor(new RGBA(255, 255, 255, 100)),
-                       m_backgroundColor(new RGBA(0, 0, 0, 100)),
+        Text::Text() : m_fontSize(14), m_renderMode(TextRenderMode::DISTANCE_FIELD),
+                       m_text(""), m_fontName(""), m_textColor(255, 255, 255, 100),
+                       m_backgroundColor(0, 0, 0, 100),
                        m_paddingTop(0.0f), m_paddingRight(0.0f), m_paddingBottom(0.0f), m_paddingLeft(0.0f),
                        m_marginTop(0.0f), m_marginRight(0.0f), m_marginBottom(0.0f), m_marginLeft(0.0f),
-                       m_size(14.0f), m_style(FontStyle::NORMAL), m_hasBackground(false) {
-            s_instanceCount++;
-
-            if (!s_initialized) {
-                if (FT_Init_FreeType(&s_library)) {
-                    throw std::runtime_error("Could not initialize FreeType Library");
-                }
-                s_initialized = true;
-            }
-
+                       m_size(14.0f), m_style(FontStyle::NORMAL), m_hasBackground(false),
+                       m_maxWidth(0.0f), m_wrap(TextWrap::WORD), m_lineHeight(1.0f), m_lineAlignment(HorizontalAlignment::LEFT),
+                       m_relayoutFrom(std::string::npos), m_cached(false), m_spriteDirty(true), m_spriteBackground(false) {
             // Initialize animator with this text object
             animator.AttachTo(this);
         }
 
         Text::~Text() {
-            CleanupCharacters();
-
-            if (m_face) {
-                FT_Done_Face(m_face);
-                m_face = nullptr;
-            }
-
-            s_instanceCount--;
-            if (s_instanceCount == 0 && s_initialized) {
-                FT_Done_FreeType(s_library);
-                s_initialized = false;
+            // The glyph set and font close with their last user, the sprite's target at the end of the frame
+            if (m_cached) {
+                TextSpriteCache::GetInstance().Remove(this);
             }
         }
 
         bool Text::LoadFont(const std::string& fontPath, unsigned int fontSize) {
-            if (m_face) {
-                FT_Done_Face(m_face);
-                m_face = nullptr;
-                CleanupCharacters();
-            }
+            MemoryScope memoryScope(MemoryTag::TEXT);
 
-            if(FT_New_Face(s_library, fontPath.c_str(), 0, &m_face)) {
+            // Distance field glyphs come from one set per font, whatever the size
+            bool distanceField = m_renderMode == TextRenderMode::DISTANCE_FIELD;
+            unsigned int glyphSize = distanceField ? FontManager::DISTANCE_FIELD_SIZE : fontSize;
+
+            FontManager& fonts = FontManager::GetInstance();
+            std::shared_ptr<GlyphSet> glyphs = fonts.Acquire(fontPath, glyphSize, distanceField);
+            m_fontPath = fontPath;
+
+            if(!glyphs) {
                 std::cerr << "Failed to load font: " << fontPath << std::endl;
                 std::cerr << "Using Arial for default" << std::endl;
 
                 m_fontPath = "C:/Windows/Fonts/Arial.TTF";
+                glyphs = fonts.Acquire(m_fontPath, glyphSize, distanceField);
 
-                if(!FT_New_Face(s_library, m_fontPath.c_str(), 0, &m_face)) {
+                if(!glyphs) {
                     std::cerr << "Can't using Arial as default font!" << std::endl;
-                   return false;
+                    m_glyphs.reset();
+                    return false;
                 }
             }
 
+            // Glyphs are rasterized on first use, shared with every Text of the same font and size (or mode)
+            m_glyphs = glyphs;
             m_fontSize = fontSize;
-            m_fontPath = fontPath;
-            m_texturesGenerated = false;  // Mark textures as not generated yet - they will be generated on first render
-            FT_Set_Pixel_Sizes(m_face, 0, fontSize);
+            m_spriteDirty = true;
+            InvalidateLayout();
 
             return true;
         }
 
-        void Text::GenerateCharacterTextures() const {
-            // CleanupCharacters(); // Skip cleanup for now in const function
-
-            // Check OpenGL errors first
-            GLenum error = glGetError();
-            if (error != GL_NO_ERROR) {
-                std::cout << "[DEBUG] OpenGL error before texture creation: " << error << std::endl;
-            }
-
-            // Create a simple test texture that should definitely work
-            unsigned int testTexture = 0;
-            glGenTextures(1, &testTexture);
-
-            error = glGetError();
-            if (error != GL_NO_ERROR) {
-                std::cout << "[DEBUG] OpenGL error after glGenTextures: " << error << std::endl;
-            }
-
-            if (testTexture == 0) {
-                std::cout << "[DEBUG] ERROR: glGenTextures returned 0! OpenGL context might not be current." << std::endl;
-                return;
-            }
-
-            glBindTexture(GL_TEXTURE_2D, testTexture);
-
-            error = glGetError();
-            if (error != GL_NO_ERROR) {
-                std::cout << "[DEBUG] OpenGL error after glBindTexture: " << error << std::endl;
-            }
-
-            // 4x4 checkerboard pattern in RGB
-            unsigned char testData[4 * 4 * 3] = {
-                255,0,0,   0,255,0,   255,0,0,   0,255,0,
-                0,255,0,   255,0,0,   0,255,0,   255,0,0,
-                255,0,0,   0,255,0,   255,0,0,   0,255,0,
-                0,255,0,   255,0,0,   0,255,0,   255,0,0
-            };
-
-            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, 4, 4, 0, GL_RGB, GL_UNSIGNED_BYTE, testData);
-
-            error = glGetError();
-            if (error != GL_NO_ERROR) {
-                std::cout << "[DEBUG] OpenGL error after glTexImage2D: " << error << std::endl;
+        const Character* Text::FindCharacter(uint32_t codepoint, bool* pending) const {
+            if (!m_glyphs) {
+                return nullptr;
             }
 
-            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+            const Character* found = m_glyphs->Find(codepoint, pending);
 
-            std::cout << "[DEBUG] Test texture setup complete, ID: " << testTexture << std::endl;
+            // Characters the font lacks show up as a replacement mark instead of vanishing
+            if (!found && codepoint > GlyphSet::LAST) {
+                found = m_glyphs->Find(Utf8::REPLACEMENT, pending);
 
-            // Now create real FreeType textures for each character
-            for (unsigned char c = 32; c < 127; c++) {
-                if (FT_Load_Char(m_face, c, FT_LOAD_RENDER)) {
-                    continue;
-                }
-
-                FT_GlyphSlot glyph = m_face->glyph;
-                FT_Bitmap& bitmap = glyph->bitmap;
-
-                unsigned int charTexture;
-                glGenTextures(1, &charTexture);
-                glBindTexture(GL_TEXTURE_2D, charTexture);
-
-                // Empty character (like space) - create 1x1 transparent texture
-                if (bitmap.width == 0 || bitmap.rows == 0) {
-                    unsigned char emptyData[4] = {255, 255, 255, 0};
-                    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, emptyData);
-
-                // Flip the bitmap data Y-axis before creating texture (FreeType liefert oben links, OpenGL erwartet unten links)
-                } else {
-                    unsigned char* flipped_buffer = new unsigned char[bitmap.width * bitmap.rows];
-                    for (int y = 0; y < bitmap.rows; y++) {
-                        for (int x = 0; x < bitmap.width; x++) {
-                            int src_index = y * bitmap.width + x;
-                            int dst_index = (bitmap.rows - 1 - y) * bitmap.width + x;
-                            flipped_buffer[dst_index] = bitmap.buffer[src_index];
-                        }
-                    }
-
-                    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
-                    glTexImage2D(GL_TEXTURE_2D, 0, GL_ALPHA, bitmap.width, bitmap.rows, 0, GL_ALPHA, GL_UNSIGNED_BYTE, flipped_buffer);
-
-                    delete[] flipped_buffer;
+                if (!found) {
+                    found = m_glyphs->Find('?', pending);
                 }
+            }
 
-                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP);
-                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP);
+            return found;
+        }
 
-                Character character = {
-                    charTexture,  // Use individual texture for each character
-                    bitmap.width,
-                    bitmap.rows,
-                    glyph->bitmap_left,
-                    glyph->bitmap_top,
-                    static_cast<unsigned int>(glyph->advance.x >> 6)
-                };
-                m_characters[c] = character;
+        float Text::GetGlyphScale() const {
+            if (!m_glyphs || m_glyphs->GetPixelSize() == 0) {
+                return 1.0f;
             }
 
-            glBindTexture(GL_TEXTURE_2D, 0);
+            return static_cast<float>(m_fontSize) / static_cast<float>(m_glyphs->GetPixelSize());
         }
 
-
         void Text::SetFontSize(unsigned int fontSize) {
-            if (m_fontSize != fontSize && m_face) {
+            if (m_fontSize != fontSize && m_glyphs && m_glyphs->IsDistanceField()) {
+                // Same glyphs drawn at another scale, nothing is rasterized
                 m_fontSize = fontSize;
-                FT_Set_Pixel_Sizes(m_face, 0, fontSize);
-                m_texturesGenerated = false;  // Mark for regeneration on next render
+                InvalidateLayout();
+                MarkResized();
+            } else if (m_fontSize != fontSize && m_glyphs) {
+                MemoryScope memoryScope(MemoryTag::TEXT);
+
+                // Another size is another shared glyph set, the old one closes if this was its last user
+                std::shared_ptr<GlyphSet> glyphs = FontManager::GetInstance().Acquire(m_fontPath, fontSize);
+
+                if (glyphs) {
+                    m_glyphs = glyphs;
+                    m_fontSize = fontSize;
+                    InvalidateLayout();
+                    MarkResized();
+                }
             }
         }
 
-        float Text::GetTextWidth(const std::string& text, float scale) const {
+        float Text::GetTextWidth(std::string_view text, float scale) const {
             float width = 0;
-            for (char c : text) {
-                auto it = m_characters.find(c);
-                if (it != m_characters.end()) {
-                    width += it->second.advance * scale;
+            uint32_t previous = 0;
+            for (size_t offset = 0; offset < text.size();) {
+                uint32_t c = Utf8::Next(text, offset);
+                if (const Character* ch = FindCharacter(c)) {
+                    width += ch->advance + (previous ? m_glyphs->GetKerning(previous, c) : 0.0f);
+                    previous = c;
                 }
             }
-            return width;
+            return width * scale * GetGlyphScale();
         }
 
         float Text::GetTextHeight(float scale) const {
@@ -216,26 +144,22 @@ namespace Engine {
         }
 
         float Text::GetActualTextHeight(const std::string& text, float scale) const {
-            if (!m_texturesGenerated) {
-                GenerateCharacterTextures();
-            }
-
             int maxBearingY = 0;
             int minBearingY = 0;
 
             // Find the actual top and bottom bounds of the text
-            for (char c : text) {
-                auto it = m_characters.find(c);
-                if (it != m_characters.end()) {
-                    const Character& ch = it->second;
-
-                    // Top of character (bearingY is distance from baseline to top)
-                    if (ch.bearingY > maxBearingY) {
-                        maxBearingY = ch.bearingY;
+            for (size_t offset = 0; offset < text.size();) {
+                if (const Character* found = FindCharacter(Utf8::Next(text, offset))) {
+                    const Character& ch = *found;
+
+                    // Top of character (bearingY is distance from baseline to top, the distance field margin isn't ink)
+                    int topY = ch.bearingY - static_cast<int>(ch.spread);
+                    if (topY > maxBearingY) {
+                        maxBearingY = topY;
                     }
 
                     // Bottom of character (height - bearingY gives distance from baseline to bottom)
-                    int bottomY = static_cast<int>(ch.height) - ch.bearingY;
+                    int bottomY = static_cast<int>(ch.height) - ch.bearingY - static_cast<int>(ch.spread);
                     if (bottomY > minBearingY) {
                         minBearingY = bottomY;
                     }
@@ -243,14 +167,7 @@ namespace Engine {
             }
 
             // Total height is distance from top to bottom
-            return static_cast<float>(maxBearingY + minBearingY) * scale;
-        }
-
-        void Text::CleanupCharacters() {
-            for (auto& pair : m_characters) {
-                glDeleteTextures(1, &pair.second.textureID);
-            }
-            m_characters.clear();
+            return static_cast<float>(maxBearingY + minBearingY) * scale * GetGlyphScale();
         }
 
         void Text::UpdateFontSizeForWindow(int windowHeight, unsigned int baseFontSize, int referenceHeight) {
@@ -265,37 +182,68 @@ namespace Engine {
                 dynamicFontSize = 8;
             }
 
-            if(dynamicFontSize != m_fontSize && m_face) {
+            if(dynamicFontSize != m_fontSize && m_glyphs) {
                 SetFontSize(dynamicFontSize);
             }
         }
 
         // New API method implementations
         void Text::SetValue(const std::string& text) {
-            m_text = text;
+            if (m_text != text) {
+                // Lines before the first changed byte keep their layout
+                size_t common = 0;
+                size_t limit = std::min(m_text.size(), text.size());
+
+                while (common < limit && m_text[common] == text[common]) {
+                    common++;
+                }
+
+                m_text = text;
+                InvalidateLayoutFrom(common);
+                MarkResized();
+            }
         }
 
         void Text::SetFont(const std::string& fontName) {
             m_fontName = fontName;
             LoadFontByName(fontName);
+            MarkResized();
         }
 
-        void Text::SetColor(IColor* color) {
-            m_textColor = color;
+        void Text::SetColor(Color color) {
+            if (m_textColor != color) {
+                m_textColor = color;
+                MarkDirty();
+            }
         }
 
-        void Text::SetBackground(IColor* color) {
-            m_backgroundColor = color;
-            m_hasBackground = true;
+        void Text::SetBackground(Color color) {
+            if (m_backgroundColor != color || !m_hasBackground) {
+                // Switching the background on grows the text by its padding
+                if (m_hasBackground) {
+                    MarkDirty();
+                } else {
+                    MarkResized();
+                }
+
+                m_backgroundColor = color;
+                m_hasBackground = true;
+            }
         }
 
         void Text::SetBackgroundEnabled(bool enabled) {
-            m_hasBackground = enabled;
+            if (m_hasBackground != enabled) {
+                m_hasBackground = enabled;
+
+                // Button switches it off around every paint, the sprite compares the flag instead
+                m_damage.MarkDirty();
+            }
         }
 
         void Text::SetPadding(float x, float y) {
             m_paddingLeft = m_paddingRight = x;
             m_paddingTop = m_paddingBottom = y;
+            MarkResized();
         }
 
         void Text::SetPadding(float top, float right, float bottom, float left) {
@@ -303,11 +251,13 @@ namespace Engine {
             m_paddingRight = right;
             m_paddingBottom = bottom;
             m_paddingLeft = left;
+            MarkResized();
         }
 
         void Text::SetMargin(float x, float y) {
             m_marginLeft = m_marginRight = x;
             m_marginTop = m_marginBottom = y;
+            MarkResized();
         }
 
         void Text::SetMargin(float top, float right, float bottom, float left) {
@@ -315,203 +265,486 @@ namespace Engine {
             m_marginRight = right;
             m_marginBottom = bottom;
             m_marginLeft = left;
+            MarkResized();
         }
 
         void Text::SetSize(float size) {
             m_size = size;
-            if (m_face) {
+            if (m_glyphs) {
                 SetFontSize(static_cast<unsigned int>(size));
             }
+            MarkDirty();
+        }
+
+        void Text::SetRenderMode(TextRenderMode mode) {
+            if (m_renderMode != mode) {
+                m_renderMode = mode;
+
+                if (m_glyphs) {
+                    LoadFont(m_fontPath, m_fontSize);
+                }
+
+                MarkResized();
+            }
+        }
+
+        void Text::SetMaxWidth(float width) {
+            if (m_maxWidth != width) {
+                m_maxWidth = width;
+                InvalidateLayout();
+                MarkResized();
+            }
+        }
+
+        void Text::SetWrap(TextWrap wrap) {
+            if (m_wrap != wrap) {
+                m_wrap = wrap;
+                InvalidateLayout();
+                MarkResized();
+            }
+        }
+
+        void Text::SetLineHeight(float factor) {
+            if (m_lineHeight != factor) {
+                m_lineHeight = factor;
+                InvalidateLayout();
+                MarkResized();
+            }
+        }
+
+        void Text::SetLineAlignment(HorizontalAlignment alignment) {
+            if (m_lineAlignment != alignment) {
+                m_lineAlignment = alignment;
+                InvalidateLayout();
+                MarkResized();
+            }
+        }
+
+        void Text::SetCached(bool cached) {
+            if (m_cached != cached) {
+                m_cached = cached;
+                m_spriteDirty = true;
+
+                if (!cached) {
+                    TextSpriteCache::GetInstance().Remove(this);
+                }
+
+                MarkDirty();
+            }
         }
 
         void Text::SetStyle(FontStyle style) {
-            m_style = style;
+            if (m_style != style) {
+                m_style = style;
+                InvalidateLayout();
+                MarkResized();
+            }
+        }
+
+        void Text::CollectDamage(DamageRegion& damage) const {
+            // Text waiting for glyphs is drawn again every frame until they arrive
+            m_damage.Collect(damage, animator.HasActiveEffects() || m_layout.pending);
         }
 
         void Text::Render(IRenderingAPI& context, float x, float y) {
-            if (m_text.empty()) {
-                return;
+            UpdateBounds(Paint(context, x, y));
+        }
+
+        const TextLayout& Text::GetLayout() {
+            GlyphAtlas& atlas = GlyphAtlas::GetInstance();
+            RenderStats& stats = RenderStats::GetInstance();
+
+            // Glyph copies of an evicted or cleared atlas page are no longer valid
+            bool settled = !m_layout.pending || m_layout.uploads == atlas.GetUploadCount();
+            bool current = m_layout.valid && settled && m_layout.generation == atlas.GetGeneration();
+
+            if (current && m_relayoutFrom == std::string::npos) {
+                stats.AddLayoutHit();
+                return m_layout;
             }
 
-            if (!m_face) {
-                return;
+            auto started = std::chrono::steady_clock::now();
+            stats.AddLayout();
+
+            // Apply text transformations (like UPPERCASE), they keep every byte offset
+            FrameString renderedText = ApplyTextTransformation(m_text);
+
+            // 1:1 for bitmap glyphs, distance fields are scaled from their reference size
+            float scale = GetGlyphScale();
+            float lineAdvance = (m_glyphs ? m_glyphs->GetLineHeight() : static_cast<float>(m_fontSize)) * scale * m_lineHeight;
+            uint32_t generation = atlas.GetGeneration();
+
+            std::vector<TextLine>& lines = m_layout.lines;
+            std::vector<PositionedGlyph>& glyphs = m_layout.glyphs;
+
+            // An edit may let its words move up onto the line before, that one is laid out again as well
+            size_t restart = 0;
+
+            if (current) {
+                while (restart + 1 < lines.size() && lines[restart + 1].start <= m_relayoutFrom) {
+                    restart++;
+                }
+
+                restart = restart > 0 ? restart - 1 : 0;
             }
 
-            // Apply text transformations (like UPPERCASE)
-            std::string renderedText = ApplyTextTransformation(m_text);
+            m_relayoutFrom = std::string::npos;
 
-            float renderX = x + m_marginLeft;
-            float renderY = y + m_marginTop;
-            
+            size_t offset = 0;
+            int charIndex = 0;
 
-            // Render background if needed
-            if (m_hasBackground) {
-                // Ensure character textures are generated before accessing characters
-                if (!m_texturesGenerated && m_face) {
-                    GenerateCharacterTextures();
-                    m_texturesGenerated = true;
+            if (restart < lines.size()) {
+                offset      = lines[restart].start;
+                charIndex   = lines[restart].firstChar;
+                glyphs.resize(lines[restart].firstGlyph);
+            } else {
+                glyphs.clear();
+            }
+
+            lines.resize(restart);
+
+            if (restart == 0) {
+                m_layout.inkLeft = 0.0f;
+                m_layout.pending = false;
+            }
+
+            bool wrapping = m_wrap != TextWrap::NONE && m_maxWidth > 0.0f;
+
+            TextLine line = { offset, charIndex, glyphs.size(), 0.0f, 0.0f };
+            float penX = 0.0f;
+            float inkEnd = 0.0f;                // Pen after the last character that isn't a space
+            uint32_t previous = 0;
+
+            // Last place on this line a word wrap may break at: after a run of spaces
+            bool canBreak = false;
+            TextLine next = {};
+            float breakX = 0.0f;
+            float breakWidth = 0.0f;
+
+            auto endLine = [&](float width, const TextLine& following) {
+                line.width = width;
+                lines.push_back(line);
+                line = following;
+                canBreak = false;
+            };
+
+            for (; offset < renderedText.size(); charIndex++) {
+                size_t charStart = offset;
+                uint32_t c = Utf8::Next(renderedText, offset);
+
+                if (c == '\n') {
+                    endLine(penX, { offset, charIndex + 1, glyphs.size(), 0.0f, 0.0f });
+                    penX = inkEnd = 0.0f;
+                    previous = 0;
+                    continue;
+                }
+
+                const Character* found = FindCharacter(c, &m_layout.pending);
+
+                if (!found) {
+                    continue;
                 }
 
-                float textWidth = GetTextWidth(renderedText);
-                float textHeight = GetTextHeight(); // Use font size based height
+                const Character& ch = *found;
+                bool space = c == ' ' || c == '\t';
+                float kerning = previous ? m_glyphs->GetKerning(previous, c) * scale : 0.0f;
+                float advance = ch.advance * scale;
+
+                if (wrapping && !space && penX > 0.0f && penX + kerning + advance > m_maxWidth) {
+                    if (m_wrap == TextWrap::WORD && canBreak) {
+                        // The word so far moves down to start the next line
+                        endLine(breakWidth, next);
+
+                        for (size_t moved = line.firstGlyph; moved < glyphs.size(); moved++) {
+                            glyphs[moved].x -= breakX;
+                            glyphs[moved].line++;
+                        }
+
+                        penX -= breakX;
+                        inkEnd -= breakX;
+                    }
 
-                // Find the actual leftmost position of the text (considering bearingX)
-                float minBearingX = 0;
-                if (!m_characters.empty() && !renderedText.empty()) {
-                    char firstChar = renderedText[0];
-                    auto it = m_characters.find(firstChar);
-                    if (it != m_characters.end()) {
-                        minBearingX = static_cast<float>(it->second.bearingX);
+                    // No space to break at, or the word alone is longer than a line
+                    if (penX > 0.0f && penX + kerning + advance > m_maxWidth) {
+                        endLine(inkEnd, { charStart, charIndex, glyphs.size(), 0.0f, 0.0f });
+                        penX = inkEnd = 0.0f;
+                        kerning = 0.0f;
                     }
                 }
 
-                float actualTextX = renderX + m_paddingLeft + minBearingX;
+                if (charIndex == 0) {
+                    m_layout.inkLeft = static_cast<float>(ch.bearingX + static_cast<int>(ch.spread)) * scale;
+                }
+
+                penX += kerning;
+
+                // Empty glyphs (space) only move the pen
+                if (ch.width > 0 && ch.height > 0) {
+                    PositionedGlyph placed;
+                    placed.codepoint    = c;
+                    placed.index        = charIndex;
+                    placed.line         = static_cast<uint32_t>(lines.size());
+                    placed.x            = penX + ch.bearingX * scale;
+                    placed.y            = -ch.bearingY * scale;
+                    placed.width        = ch.width * scale;
+                    placed.height       = ch.height * scale;
+                    placed.glyph        = ch;
+                    glyphs.push_back(placed);
+                }
+
+                penX += advance;
+                previous = c;
+
+                if (space) {
+                    canBreak    = true;
+                    next        = { offset, charIndex + 1, glyphs.size(), 0.0f, 0.0f };
+                    breakX      = penX;
+                    breakWidth  = inkEnd;
+                } else {
+                    inkEnd = penX;
+                }
+            }
+
+            line.width = penX;
+            lines.push_back(line);
+
+            // Widest line, the others are aligned inside it
+            m_layout.width = 0.0f;
+
+            for (const TextLine& each : lines) {
+                m_layout.width = std::max(m_layout.width, each.width);
+            }
+
+            float factor = m_lineAlignment == HorizontalAlignment::CENTER ? 0.5f : (m_lineAlignment == HorizontalAlignment::RIGHT ? 1.0f : 0.0f);
+
+            for (TextLine& each : lines) {
+                each.x = (m_layout.width - each.width) * factor;
+            }
+
+            // Top of the ink of the first line, without the distance field margin
+            int maxBearingY = 0;
+
+            for (const PositionedGlyph& placed : glyphs) {
+                if (placed.line > 0) {
+                    break;
+                }
+
+                maxBearingY = std::max(maxBearingY, placed.glyph.bearingY - static_cast<int>(placed.glyph.spread));
+            }
+
+            m_layout.baseline       = maxBearingY * scale;
+            m_layout.lineAdvance    = lineAdvance;
+            m_layout.height         = GetTextHeight() + (lines.size() - 1) * lineAdvance;
+            // Taken before the lookups, glyphs they evicted from earlier lines are replaced on the next call
+            m_layout.generation     = generation;
+            m_layout.uploads        = atlas.GetUploadCount();
+            m_layout.valid          = true;
+
+            std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - started;
+            stats.AddLayoutTime(static_cast<uint64_t>(elapsed.count()));
+
+            return m_layout;
+        }
+
+        Rect Text::Paint(IRenderingAPI& context, float x, float y) {
+            MemoryScope memoryScope(MemoryTag::TEXT);
+
+            if (m_text.empty()) {
+                return Rect();
+            }
+
+            if (!m_glyphs) {
+                return Rect();
+            }
+
+            // Effects move single glyphs, a text with running effects is drawn glyph by glyph
+            if (m_cached && !animator.HasActiveEffects()) {
+                Rect bounds;
+
+                if (PaintSprite(context, x, y, bounds)) {
+                    return bounds;
+                }
+            }
+
+            return PaintGlyphs(context, x, y);
+        }
+
+        bool Text::PaintSprite(IRenderingAPI& context, float x, float y, Rect& bounds) {
+            TextSpriteCache& cache = TextSpriteCache::GetInstance();
+            TextSprite* sprite = cache.Find(this);
+
+            if (!sprite || m_spriteDirty || m_spriteBackground != m_hasBackground) {
+                const TextLayout& layout = GetLayout();
+
+                // Nothing to render before every glyph is there
+                if (layout.pending) {
+                    return false;
+                }
+
+                Rect content = GetContentBounds(layout);
+
+                if (content.IsEmpty()) {
+                    return false;
+                }
+
+                // Whole pixels, the sprite is drawn 1:1 without filtering
+                float left = std::floor(content.x);
+                float top = std::floor(content.y);
+                int width = static_cast<int>(std::ceil(content.GetRight()) - left);
+                int height = static_cast<int>(std::ceil(content.GetBottom()) - top);
+
+                sprite = cache.Create(context, this, width, height);
+
+                if (!sprite) {
+                    return false;
+                }
+
+                sprite->left = left;
+                sprite->top = top;
+
+                // Alpha blended onto transparent black, the target ends up premultiplied
+                context.BeginOffscreen(sprite->target);
+                context.Clear(Color(0, 0, 0, 0));
+                PaintGlyphs(context, -left, -top);
+                context.EndOffscreen();
+
+                m_spriteDirty = false;
+                m_spriteBackground = m_hasBackground;
+            }
+
+            float spriteX = std::round(x) + sprite->left;
+            float spriteY = std::round(y) + sprite->top;
+            float spriteWidth = static_cast<float>(sprite->target.width);
+            float spriteHeight = static_cast<float>(sprite->target.height);
+
+            context.DrawPremultiplied(sprite->target, spriteX, spriteY, spriteWidth, spriteHeight);
+
+            bounds = Rect(spriteX, spriteY, spriteWidth, spriteHeight);
+            return true;
+        }
+
+        Rect Text::GetContentBounds(const TextLayout& layout) const {
+            Rect bounds;
+
+            if (m_hasBackground) {
+                float bgX = m_marginLeft + layout.inkLeft;
+                float bgY = m_marginTop - m_paddingTop;
+                bounds = Rect(bgX, bgY, layout.width + m_paddingLeft + m_paddingRight, layout.height + m_paddingTop + m_paddingBottom);
+            }
+
+            float textX = m_marginLeft + m_paddingLeft;
+            float textY = m_marginTop + m_paddingTop + layout.baseline;
+
+            for (const PositionedGlyph& placed : layout.glyphs) {
+                float glyphX = textX + layout.lines[placed.line].x + placed.x;
+                float glyphY = textY + placed.line * layout.lineAdvance + placed.y;
+                bounds = bounds.Union(Rect(glyphX, glyphY, placed.width, placed.height));
+            }
+
+            return bounds;
+        }
+
+        Rect Text::PaintGlyphs(IRenderingAPI& context, float x, float y) {
+            Rect bounds;
+
+            const TextLayout& layout = GetLayout();
+
+            // Drawn once every glyph is there, instead of stalling the frame or popping in glyph by glyph
+            if (layout.pending) {
+                return bounds;
+            }
+
+            float renderX = x + m_marginLeft;
+            float renderY = y + m_marginTop;
+
+            // Render background if needed
+            if (m_hasBackground) {
+                float textHeight = layout.height; // Font size based height of every line
+
+                // The background starts at the ink of the first character
+                float actualTextX = renderX + m_paddingLeft + layout.inkLeft;
                 float bgX = actualTextX - m_paddingLeft;
                 float bgY = renderY - m_paddingTop;
-                float bgWidth = textWidth + m_paddingLeft + m_paddingRight;
+                float bgWidth = layout.width + m_paddingLeft + m_paddingRight;
                 float bgHeight = textHeight + m_paddingTop + m_paddingBottom;
 
+                // Background goes through the render queue like the glyphs
+                context.DrawRect(bgX, bgY, bgWidth, bgHeight, m_backgroundColor);
 
-                // Simple background rendering using OpenGL quads
-                glDisable(GL_TEXTURE_2D);
-                glEnable(GL_BLEND);
-                glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+                bounds = bounds.Union(Rect(bgX, bgY, bgWidth, bgHeight));
+            }
 
-                glColor4f(m_backgroundColor->GetRed(), m_backgroundColor->GetGreen(),
-                         m_backgroundColor->GetBlue(), m_backgroundColor->GetAlpha());
+            // Render text with padding offset
+            float textX = renderX + m_paddingLeft;
+            float textY = renderY + m_paddingTop + layout.baseline;
 
-                glBegin(GL_QUADS);
-                    glVertex2f(bgX, bgY);
-                    glVertex2f(bgX + bgWidth, bgY);
-                    glVertex2f(bgX + bgWidth, bgY + bgHeight);
-                    glVertex2f(bgX, bgY + bgHeight);
-                glEnd();
+            RenderStats& stats = RenderStats::GetInstance();
+            GlyphAtlas& atlas = GlyphAtlas::GetInstance();
+            bool distanceField = m_glyphs->IsDistanceField();
 
-                glDisable(GL_BLEND);
+            // Cached quads as parallel arrays, every running effect moves all of them in one pass
+            GlyphStream glyphs;
+            glyphs.Reserve(layout.glyphs.size());
+
+            for (const PositionedGlyph& placed : layout.glyphs) {
+                // Keeps the page alive for this frame, the layout doesn't go through the glyph set
+                atlas.Touch(placed.glyph);
+
+                float glyphX = textX + layout.lines[placed.line].x + placed.x;
+                float glyphY = textY + placed.line * layout.lineAdvance + placed.y;
+                glyphs.Push(glyphX, glyphY, placed.width, placed.height, placed.index, m_textColor);
             }
 
-            // Render text with padding offset
-            float textX = renderX + m_paddingLeft;
-            float textY = renderY + m_paddingTop;
-
-            // Inline text rendering (replaces RenderText call)
-            if(!m_texturesGenerated && m_face) {
-                GenerateCharacterTextures();
-                m_texturesGenerated = true;
-            }
-
-            if(!m_characters.empty() && !renderedText.empty()) {
-                // Use the current coordinate system directly (no matrix changes)
-                glEnable(GL_BLEND);
-                glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-                glEnable(GL_TEXTURE_2D);
-
-                // Set color
-                glColor4f(m_textColor->GetRed(), m_textColor->GetGreen(), m_textColor->GetBlue(), m_textColor->GetAlpha());
-
-                float scale = 1.0f; // Direct 1:1 pixel mapping
-                float posX = textX;
-
-                // Calculate maxBearingY for baseline alignment
-                float maxBearingY = 0;
-                for(char c : renderedText) {
-                    auto it = m_characters.find(c);
-                    if(it != m_characters.end()) {
-                        const Character& ch = it->second;
-                        if(ch.bearingY > maxBearingY) {
-                            maxBearingY = static_cast<float>(ch.bearingY);
-                        }
-                    }
+            animator.ApplyEffectsToStream(glyphs);
+
+            for (size_t i = 0; i < glyphs.Size(); ++i) {
+                const Character& ch = layout.glyphs[i].glyph;
+                float width = glyphs.width[i];
+                float height = glyphs.height[i];
+
+                // Only render if character is visible and has size
+                if (!glyphs.visible[i] || width <= 0 || height <= 0) {
+                    continue;
                 }
 
-                // Render characters with animation support
-                int charIndex = 0;
-                for(char c : renderedText) {
-                    auto it = m_characters.find(c);
-                    if(it == m_characters.end()) {
-                        charIndex++;
-                        continue;
-                    }
+                stats.AddGlyphs(1);
 
-                    const Character& ch = it->second;
-
-                    float baseXpos = posX + ch.bearingX * scale;
-                    float baseYpos = textY + (maxBearingY - ch.bearingY) * scale;
-                    float baseW = ch.width * scale;
-                    float baseH = ch.height * scale;
-
-                    // Initialize character rendering state
-                    CharacterRenderState renderState;
-                    renderState.x = baseXpos;
-                    renderState.y = baseYpos;
-                    renderState.width = baseW;
-                    renderState.height = baseH;
-                    renderState.color = m_textColor;
-                    renderState.visible = true;
-                    renderState.scale = 1.0f;
-                    renderState.rotation = 0.0f;
-
-                    // Apply animation effects to this character
-                    animator.ApplyEffectsToCharacter(context, c, charIndex, renderState);
-
-                    // Only render if character is visible and has size
-                    if (renderState.visible && renderState.width > 0 && renderState.height > 0) {
-                        glBindTexture(GL_TEXTURE_2D, ch.textureID);
-
-                        // Apply character-specific color
-                        glColor4f(renderState.color->GetRed(), renderState.color->GetGreen(),
-                                 renderState.color->GetBlue(), renderState.color->GetAlpha());
-
-                        // Handle rotation if needed
-                        if (renderState.rotation != 0.0f) {
-                            glPushMatrix();
-                            glTranslatef(renderState.x + renderState.width/2, renderState.y + renderState.height/2, 0);
-                            glRotatef(renderState.rotation, 0, 0, 1);
-                            glTranslatef(-renderState.width/2, -renderState.height/2, 0);
-
-                            glBegin(GL_QUADS);
-                                glTexCoord2f(0.0f, 1.0f); glVertex2f(0, 0);
-                                glTexCoord2f(1.0f, 1.0f); glVertex2f(renderState.width * renderState.scale, 0);
-                                glTexCoord2f(1.0f, 0.0f); glVertex2f(renderState.width * renderState.scale, renderState.height * renderState.scale);
-                                glTexCoord2f(0.0f, 0.0f); glVertex2f(0, renderState.height * renderState.scale);
-                            glEnd();
-
-                            glPopMatrix();
-                        } else {
-                            // Simple rendering without rotation
-                            float finalW = renderState.width * renderState.scale;
-                            float finalH = renderState.height * renderState.scale;
-
-                            glBegin(GL_QUADS);
-                                glTexCoord2f(0.0f, 1.0f); glVertex2f(renderState.x, renderState.y);
-                                glTexCoord2f(1.0f, 1.0f); glVertex2f(renderState.x + finalW, renderState.y);
-                                glTexCoord2f(1.0f, 0.0f); glVertex2f(renderState.x + finalW, renderState.y + finalH);
-                                glTexCoord2f(0.0f, 0.0f); glVertex2f(renderState.x, renderState.y + finalH);
-                            glEnd();
-                        }
-                    }
+                // All glyphs of the string share the atlas page, the render queue batches them into one bind
+                float finalW = width * glyphs.scale[i];
+                float finalH = height * glyphs.scale[i];
+                float rotation = glyphs.rotation[i];
+                Color color = glyphs.GetColor(i);
 
-                    posX += ch.advance * scale;
-                    charIndex++;
+                if (distanceField) {
+                    context.DrawDistanceGlyph(ch.texture, glyphs.x[i], glyphs.y[i], finalW, finalH, ch.u0, ch.v0, ch.u1, ch.v1, color, rotation);
+                } else {
+                    context.DrawGlyph(ch.texture, glyphs.x[i], glyphs.y[i], finalW, finalH, ch.u0, ch.v0, ch.u1, ch.v1, color, rotation);
                 }
 
-                glBindTexture(GL_TEXTURE_2D, 0);
-                glDisable(GL_BLEND);
-                glDisable(GL_TEXTURE_2D);
+                if (rotation != 0.0f) {
+                    // Rotated quad stays inside the circle around its center
+                    float radius = std::sqrt(width * width + height * height) * glyphs.scale[i];
+                    float centerX = glyphs.x[i] + width / 2;
+                    float centerY = glyphs.y[i] + height / 2;
+                    bounds = bounds.Union(Rect(centerX - radius, centerY - radius, radius * 2, radius * 2));
+                } else {
+                    bounds = bounds.Union(Rect(glyphs.x[i], glyphs.y[i], finalW, finalH));
+                }
             }
+
+            return bounds;
         }
 
         void Text::Render(IRenderingAPI& context, const TextAlignment& alignment) {
-            if (m_text.empty() || !m_face) {
+            if (m_text.empty() || !m_glyphs) {
+                UpdateBounds(Rect());
                 return;
             }
 
-            // Apply text transformations (like UPPERCASE)
-            std::string renderedText = ApplyTextTransformation(m_text);
-
             // Calculate text dimensions including padding and margin
-            float textWidth = GetTextWidth(renderedText);
-            float textHeight = GetTextHeight();
+            const TextLayout& layout = GetLayout();
+            float textWidth = layout.width;
+            float textHeight = layout.height;
             float totalWidth = textWidth + m_paddingLeft + m_paddingRight + m_marginLeft + m_marginRight;
             float totalHeight = textHeight + m_paddingTop + m_paddingBottom + m_marginTop + m_marginBottom;
 
@@ -571,16 +804,19 @@ namespace Engine {
             }
         }
 
-        std::string Text::ApplyTextTransformation(const std::string& text) const {
-            std::string transformedText = text;
+        FrameString Text::ApplyTextTransformation(const std::string& text) const {
+            FrameString transformedText(text.begin(), text.end(), &FrameArena::Get());
 
+            // Only ASCII letters change case, bytes of multi-byte UTF-8 sequences are left alone
             // Apply UPPERCASE transformation if style contains UPPERCASE
             if (static_cast<int>(m_style) & static_cast<int>(FontStyle::UPPERCASE)) {
-                std::transform(transformedText.begin(), transformedText.end(), transformedText.begin(), ::toupper);
+                std::transform(transformedText.begin(), transformedText.end(), transformedText.begin(),
+                    [](char c) { return (c >= 'a' && c <= 'z') ? static_cast<char>(c - 'a' + 'A') : c; });
             }
             // Apply LOWERCASE transformation if style contains LOWERCASE
             else if (static_cast<int>(m_style) & static_cast<int>(FontStyle::LOWERCASE)) {
-                std::transform(transformedText.begin(), transformedText.end(), transformedText.begin(), ::tolower);
+                std::transform(transformedText.begin(), transformedText.end(), transformedText.begin(),
+                    [](char c) { return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c; });
             }
 
             return transformedText;
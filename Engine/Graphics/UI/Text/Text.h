@@ -1,15 +1,16 @@
 #pragma once
 
-#include "../../IColor.h"
-#include "../../RGBA.h"
+#include "../../Color.h"
 #include "../Alignment.h"
 #include "../Animator.h"
+#include "../../DamageRegion.h"
+#include "../../../Core/FrameArena.h"
+#include "FontManager.h"
 #include <string>
+#include <string_view>
 #include <memory>
-#include <map>
-
-#include <ft2build.h>
-#include FT_FREETYPE_H
+#include <vector>
+#include <algorithm>
 
 #ifdef _WIN32
     #include <windows.h>
@@ -39,6 +40,17 @@ namespace Engine {
 
         DEFINE_ENUM_FLAG_OPERATORS(FontStyle)
 
+        enum class TextRenderMode {
+            DISTANCE_FIELD,     // Rasterized once, scaled to any font size and by effects without blurring
+            BITMAP              // Rasterized per font size, pixel exact at that size
+        };
+
+        enum class TextWrap {
+            NONE,               // Lines only end at '\n'
+            WORD,               // Breaks at spaces, words longer than a line at any character
+            CHARACTER           // Breaks at any character
+        };
+
         struct TextAlignment {
             HorizontalAlignment horizontal;
             VerticalAlignment vertical;
@@ -59,11 +71,41 @@ namespace Engine {
             static const TextAlignment BOTTOM_RIGHT;
         };
 
-        struct Character {
-            unsigned int textureID;
-            unsigned int width, height;
-            int bearingX, bearingY;
-            unsigned int advance;
+        // Glyph metrics and its place in the shared atlas
+        using Character = AtlasGlyph;
+
+        // Glyph quad relative to the start of its line on the baseline
+        struct PositionedGlyph {
+            uint32_t codepoint;
+            int index;                  // Codepoint index, effects are applied per character
+            uint32_t line;
+            float x, y;
+            float width, height;
+            Character glyph;
+        };
+
+        // One line of the layout, relayout after an edit restarts at a line start
+        struct TextLine {
+            size_t start;               // Byte offset in the transformed string
+            int firstChar;              // Codepoint index of the first character
+            size_t firstGlyph;          // First of its entries in TextLayout::glyphs
+            float width;                // Advances, without the spaces a wrap ended it at
+            float x;                    // Offset of the line alignment
+        };
+
+        // Positioned glyphs of the transformed string, kept until value, style, size, font or wrapping change
+        struct TextLayout {
+            std::vector<PositionedGlyph> glyphs;    // Only glyphs with ink, spaces just move the pen
+            std::vector<TextLine> lines;
+            float width         = 0.0f;             // Widest line
+            float height        = 0.0f;             // Font size plus the line advance of every further line
+            float lineAdvance   = 0.0f;
+            float inkLeft       = 0.0f;             // Bearing of the first character
+            float baseline      = 0.0f;             // From the top of the tallest glyph of the first line
+            uint32_t generation = 0;                // Atlas generation the glyph copies belong to
+            uint64_t uploads    = 0;                // Atlas upload count when built
+            bool pending        = false;            // Some glyphs are still being rasterized, the text isn't drawn yet
+            bool valid          = false;
         };
 
         class Text {
@@ -74,8 +116,8 @@ namespace Engine {
             // New API methods
             void SetValue(const std::string& text);
             void SetFont(const std::string& fontName);
-            void SetColor(IColor* color);
-            void SetBackground(IColor* color);
+            void SetColor(Color color);
+            void SetBackground(Color color);
             void SetBackgroundEnabled(bool enabled);
             void SetPadding(float x, float y);
             void SetPadding(float top, float right, float bottom, float left);
@@ -83,6 +125,20 @@ namespace Engine {
             void SetMargin(float top, float right, float bottom, float left);
             void SetSize(float size);
             void SetStyle(FontStyle style);
+            void SetRenderMode(TextRenderMode mode);
+            TextRenderMode GetRenderMode() const { return m_renderMode; }
+
+            // Paragraphs: lines wrap at maxWidth (0 for no limit), line height is a multiple of the font's
+            void SetMaxWidth(float width);
+            void SetWrap(TextWrap wrap);
+            void SetLineHeight(float factor);
+            void SetLineAlignment(HorizontalAlignment alignment);
+            size_t GetLineCount() { return GetLayout().lines.size(); }
+
+            // Static labels: rendered once into a sprite (TextSpriteCache) and drawn as one quad while no
+            // effect runs. Value, style, color, size or padding changes render it again, moving doesn't.
+            void SetCached(bool cached);
+            bool IsCached() const { return m_cached; }
             virtual void Render(IRenderingAPI& context, float x, float y);
             virtual void Render(IRenderingAPI& context, const TextAlignment& alignment);
 
@@ -90,13 +146,18 @@ namespace Engine {
             virtual void Update(float deltaTime);
             TextAnimator& GetAnimator() { return animator; }
 
+            // Damage tracking (bounds of the last Render call)
+            bool IsDirty() const { return m_damage.IsDirty() || animator.HasActiveEffects() || m_layout.pending; }
+            const Rect& GetBounds() const { return m_damage.GetBounds(); }
+            void CollectDamage(DamageRegion& damage) const;
+
             // Legacy methods (keep for compatibility)
             bool LoadFont(const std::string& fontPath, unsigned int fontSize = 48);
 
             void SetFontSize(unsigned int fontSize);
             unsigned int GetFontSize() const { return m_fontSize; }
 
-            float GetTextWidth(const std::string& text, float scale = 1.0f) const;
+            float GetTextWidth(std::string_view text, float scale = 1.0f) const;
             float GetTextHeight(float scale = 1.0f) const;
             Padding GetPadding() const {
                 return { m_paddingLeft, m_paddingRight, m_paddingTop, m_paddingBottom };
@@ -108,36 +169,69 @@ namespace Engine {
             // Schriftgröße dynamisch an Fensterhöhe anpassen (im Resize-Callback aufrufen)
             void UpdateFontSizeForWindow(int windowHeight, unsigned int baseFontSize, int referenceHeight = 720);
 
+        protected:
+            // Draws the text and returns the covered area
+            Rect Paint(IRenderingAPI& context, float x, float y);
+            void UpdateBounds(const Rect& bounds) { m_damage.Update(bounds); }
+            void MarkDirty() { m_damage.MarkDirty(); m_spriteDirty = true; }
+            void MarkResized() { m_damage.MarkResized(); m_spriteDirty = true; }
+
         private:
-            void GenerateCharacterTextures() const;  // Made const for lazy loading
-            void CleanupCharacters();
+            // Glyph of a codepoint, the font's replacement glyph if it has none
+            const Character* FindCharacter(uint32_t codepoint, bool* pending = nullptr) const;
+            // Font size over the size the glyphs were rasterized at
+            float GetGlyphScale() const;
             void LoadFontByName(const std::string& fontName);
-            std::string ApplyTextTransformation(const std::string& text) const;
-
-            static bool s_initialized;
-            static FT_Library s_library;
-            static int s_instanceCount;
-
-            // Legacy font loading
-            FT_Face m_face;
+            // Transformed copy lives in the frame arena
+            FrameString ApplyTextTransformation(const std::string& text) const;
+
+            // Glyph by glyph with the running effects
+            Rect PaintGlyphs(IRenderingAPI& context, float x, float y);
+            // From the sprite, rendered first when missing or outdated; false if the text has to be drawn by glyphs
+            bool PaintSprite(IRenderingAPI& context, float x, float y, Rect& bounds);
+            // Background and glyph quads without effects, relative to the position the text is drawn at
+            Rect GetContentBounds(const TextLayout& layout) const;
+
+            // Cached layout, rebuilt after InvalidateLayout, when the atlas dropped its glyphs or got the pending ones.
+            // After InvalidateLayoutFrom only the lines from the one before the edited byte are laid out again.
+            const TextLayout& GetLayout();
+            void InvalidateLayout() { m_layout.valid = false; }
+            void InvalidateLayoutFrom(size_t offset) { m_relayoutFrom = std::min(m_relayoutFrom, offset); }
+
+            // Shared with every Text using the same font file and size
+            std::shared_ptr<GlyphSet> m_glyphs;
             unsigned int m_fontSize;
-            std::string m_fontPath;  // Store font path for lazy loading
-            mutable std::map<char, Character> m_characters;  // Made mutable
-            mutable bool m_texturesGenerated;  // Track if textures are generated
+            std::string m_fontPath;  // Store font path for size changes
+            TextRenderMode m_renderMode;
 
             // New text properties
             std::string m_text;
             std::string m_fontName;
-            IColor* m_textColor;
-            IColor* m_backgroundColor;
+            Color m_textColor;
+            Color m_backgroundColor;
             float m_paddingTop, m_paddingRight, m_paddingBottom, m_paddingLeft;
             float m_marginTop, m_marginRight, m_marginBottom, m_marginLeft;
             float m_size;
             FontStyle m_style;
             bool m_hasBackground;
 
+            float m_maxWidth;
+            TextWrap m_wrap;
+            float m_lineHeight;
+            HorizontalAlignment m_lineAlignment;
+
+            TextLayout m_layout;
+            size_t m_relayoutFrom;
+
+            bool m_cached;
+            bool m_spriteDirty;
+            bool m_spriteBackground;    // Background state the sprite was rendered with
+
             // Animation system
             TextAnimator animator;
+
+            // Damage tracking
+            DamageTracker m_damage;
         };
     }
 }
@@ -0,0 +1,116 @@
+#include "TextSpriteCache.h"
+#include "../../IRenderingAPI.h"
+#include <algorithm>
+
+namespace Engine {
+    namespace Graphics {
+        TextSpriteCache& TextSpriteCache::GetInstance() {
+            static TextSpriteCache instance;
+            return instance;
+        }
+
+        TextSprite* TextSpriteCache::Find(const void* owner) {
+            auto it = sprites.find(owner);
+
+            if(it == sprites.end()) {
+                return nullptr;
+            }
+
+            it->second.lastUsed = frame;
+            return &it->second;
+        }
+
+        TextSprite* TextSpriteCache::Create(IRenderingAPI& context, const void* owner, int width, int height) {
+            auto it = sprites.find(owner);
+
+            if(it != sprites.end()) {
+                // Same size: drawn over, no new target
+                if(it->second.target.width == width && it->second.target.height == height) {
+                    it->second.lastUsed = frame;
+                    return &it->second;
+                }
+
+                Release(it->second.target);
+                sprites.erase(it);
+            }
+
+            if(width <= 0 || height <= 0) {
+                return nullptr;
+            }
+
+            size_t size = static_cast<size_t>(width) * height * 4;
+
+            if(size > budget) {
+                return nullptr;
+            }
+
+            while(bytes + size > budget) {
+                if(!Evict()) {
+                    return nullptr;
+                }
+            }
+
+            RenderTarget target = context.CreateRenderTarget(width, height);
+
+            if(!target.IsValid()) {
+                return nullptr;
+            }
+
+            bytes += size;
+
+            TextSprite& sprite = sprites[owner];
+            sprite.target   = target;
+            sprite.left     = 0.0f;
+            sprite.top      = 0.0f;
+            sprite.lastUsed = frame;
+            return &sprite;
+        }
+
+        void TextSpriteCache::Remove(const void* owner) {
+            auto it = sprites.find(owner);
+
+            if(it == sprites.end()) {
+                return;
+            }
+
+            Release(it->second.target);
+            sprites.erase(it);
+        }
+
+        void TextSpriteCache::EndFrame(IRenderingAPI& context) {
+            TextSpriteCache& cache = GetInstance();
+
+            for(RenderTarget& target : cache.released) {
+                context.DestroyRenderTarget(target);
+            }
+
+            cache.released.clear();
+            cache.frame++;
+        }
+
+        void TextSpriteCache::Release(RenderTarget& target) {
+            bytes -= std::min(bytes, GetSize(target));
+            released.push_back(target);
+            target = RenderTarget{};
+        }
+
+        bool TextSpriteCache::Evict() {
+            auto coldest = sprites.end();
+
+            for(auto it = sprites.begin(); it != sprites.end(); ++it) {
+                if(it->second.lastUsed < frame && (coldest == sprites.end() || it->second.lastUsed < coldest->second.lastUsed)) {
+                    coldest = it;
+                }
+            }
+
+            if(coldest == sprites.end()) {
+                return false;
+            }
+
+            Release(coldest->second.target);
+            sprites.erase(coldest);
+            evictions++;
+            return true;
+        }
+    }
+}
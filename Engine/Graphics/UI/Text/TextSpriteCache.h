@@ -0,0 +1,77 @@
+#pragma once
+
+#include "../../RenderTarget.h"
+#include <unordered_map>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace Engine {
+    namespace Graphics {
+        class IRenderingAPI;
+
+        // Offscreen copy of a Text, drawn as one quad
+        struct TextSprite {
+            RenderTarget target;
+            float left;                 // Top-left of the target from the position the text is drawn at
+            float top;
+            uint64_t lastUsed;
+        };
+
+        /*
+         * Rendered Texts (Text::SetCached) kept in offscreen targets with
+         * premultiplied alpha, one per text. Their memory is limited by a
+         * budget: a sprite that doesn't fit evicts the ones drawn least
+         * recently, never one drawn in the current frame (its quad may still
+         * be queued). Texts without a sprite draw glyph by glyph.
+         *
+         * Dropped targets are destroyed in EndFrame, so a Text can let go of
+         * its sprite without a context. Render thread only.
+         */
+        class TextSpriteCache {
+            public:
+                static TextSpriteCache& GetInstance();
+
+                // Sprite of owner marked as drawn in this frame, nullptr if it has none
+                TextSprite* Find(const void* owner);
+
+                // Empty sprite of width x height for owner (an old one of the same size is reused),
+                // nullptr without offscreen targets or when it doesn't fit the budget
+                TextSprite* Create(IRenderingAPI& context, const void* owner, int width, int height);
+
+                // Drops the sprite of owner
+                void Remove(const void* owner);
+
+                // Render thread, after presenting: destroys dropped targets
+                static void EndFrame(IRenderingAPI& context);
+
+                // Texture memory all sprites may use
+                void SetBudget(size_t bytes) { budget = bytes; }
+                size_t GetBudget() const { return budget; }
+
+                size_t GetBytes() const { return bytes; }
+                size_t GetCount() const { return sprites.size(); }
+                uint64_t GetEvictions() const { return evictions; }
+
+                static const size_t DEFAULT_BUDGET = 8 * 1024 * 1024;
+
+            private:
+                TextSpriteCache() = default;
+
+                static size_t GetSize(const RenderTarget& target) { return static_cast<size_t>(target.width) * target.height * 4; }
+
+                // Moves the target to the ones destroyed in EndFrame
+                void Release(RenderTarget& target);
+
+                // Drops the sprite drawn least recently before this frame, false if there is none
+                bool Evict();
+
+                std::unordered_map<const void*, TextSprite> sprites;
+                std::vector<RenderTarget> released;
+                size_t bytes        = 0;
+                size_t budget       = DEFAULT_BUDGET;
+                uint64_t frame      = 1;
+                uint64_t evictions  = 0;
+        };
+    }
+}
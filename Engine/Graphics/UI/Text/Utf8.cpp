@@ -0,0 +1,57 @@
+#include "Utf8.h"
+
+namespace Engine {
+    namespace Graphics {
+        namespace Utf8 {
+            uint32_t Next(std::string_view text, size_t& offset) {
+                const unsigned char lead = static_cast<unsigned char>(text[offset++]);
+
+                if(lead < 0x80) {
+                    return lead;
+                }
+
+                size_t length;
+                uint32_t codepoint;
+                uint32_t minimum;
+
+                if((lead & 0xE0) == 0xC0) {
+                    length      = 1;
+                    codepoint   = lead & 0x1F;
+                    minimum     = 0x80;
+                } else if((lead & 0xF0) == 0xE0) {
+                    length      = 2;
+                    codepoint   = lead & 0x0F;
+                    minimum     = 0x800;
+                } else if((lead & 0xF8) == 0xF0) {
+                    length      = 3;
+                    codepoint   = lead & 0x07;
+                    minimum     = 0x10000;
+                } else {
+                    return REPLACEMENT;
+                }
+
+                if(offset + length > text.size()) {
+                    return REPLACEMENT;
+                }
+
+                for(size_t index = 0; index < length; index++) {
+                    const unsigned char next = static_cast<unsigned char>(text[offset + index]);
+
+                    if((next & 0xC0) != 0x80) {
+                        return REPLACEMENT;
+                    }
+
+                    codepoint = (codepoint << 6) | (next & 0x3F);
+                }
+
+                // Overlong forms, surrogates and values past Unicode are rejected
+                if(codepoint < minimum || codepoint > 0x10FFFF || (codepoint >= 0xD800 && codepoint <= 0xDFFF)) {
+                    return REPLACEMENT;
+                }
+
+                offset += length;
+                return codepoint;
+            }
+        }
+    }
+}
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <string_view>
+#include <cstdint>
+
+namespace Engine {
+    namespace Graphics {
+        namespace Utf8 {
+            const uint32_t REPLACEMENT = 0xFFFD;
+
+            // Codepoint starting at offset, offset is moved past it. Malformed bytes decode to REPLACEMENT one at a time
+            uint32_t Next(std::string_view text, size_t& offset);
+        }
+    }
+}
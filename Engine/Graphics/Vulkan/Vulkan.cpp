@@ -76,6 +76,11 @@ namespace Engine {
                 return "Vulkan 1.3 (Not Implemented)";
             }
 
+            std::vector<std::string> Vulkan::GetFeatures() {
+                // TODO: Report instance/device extensions
+                return {};
+            }
+
             bool Vulkan::Init(std::shared_ptr<NativeWindow> window) {
                 if (initialized) {
                     return true;
@@ -199,13 +204,13 @@ namespace Engine {
             }
 
             void Vulkan::Clear() {
-                Clear(new RGBA(0, 0, 0, 255));
+                Clear(Color(0, 0, 0, 100));
             }
 
-            void Vulkan::Clear(IColor* color) {
+            void Vulkan::Clear(Color color) {
                 // TODO: Clear Vulkan framebuffer
                 // VkClearValue clearColor = {};
-                // clearColor.color = {{color->GetRed()/255.0f, color->GetGreen()/255.0f, color->GetBlue()/255.0f, color->GetAlpha()/255.0f}};
+                // clearColor.color = {{color.GetRed()/255.0f, color.GetGreen()/255.0f, color.GetBlue()/255.0f, color.GetAlpha()/255.0f}};
                 // Begin render pass with clear
                 std::cout << "[Vulkan] Clear() - Not implemented" << std::endl;
             }
@@ -244,6 +249,22 @@ namespace Engine {
                 return texture;
             }
 
+            Texture Vulkan::CreateTexture(const Image& image) {
+                // TODO: Upload through a staging buffer into a sampled VkImage
+                Texture texture;
+                texture.id = 0;
+                texture.width = image.width;
+                texture.height = image.height;
+
+                std::cout << "[Vulkan] CreateTexture() - Not implemented" << std::endl;
+                return texture;
+            }
+
+            void Vulkan::DestroyTexture(Texture& texture) {
+                // TODO: Destroy image, memory, view and sampler
+                texture = Texture{};
+            }
+
             void Vulkan::DrawTexture(const Texture& texture, float x, float y, float width, float height) {
                 // TODO: Draw texture using Vulkan
                 std::cout << "[Vulkan] DrawTexture() - Not implemented" << std::endl;
@@ -254,22 +275,94 @@ namespace Engine {
                 std::cout << "[Vulkan] DrawTextureBlurred() - Not implemented" << std::endl;
             }
 
-            void Vulkan::DrawDiagonalLines(float x, float y, float width, float height, float lineSpacing, float lineWidth, IColor* color) {
+            RenderTarget Vulkan::CreateRenderTarget(int width, int height) {
+                // TODO: Create VkImage + VkFramebuffer for offscreen rendering
+                std::cout << "[Vulkan] CreateRenderTarget(" << width << ", " << height << ") - Not implemented" << std::endl;
+                return RenderTarget{};
+            }
+
+            void Vulkan::DestroyRenderTarget(RenderTarget& target) {
+                // TODO: Destroy offscreen image and framebuffer
+                target = RenderTarget{};
+            }
+
+            void Vulkan::BindRenderTarget(const RenderTarget* target) {
+                // TODO: Begin render pass on the offscreen framebuffer
+                std::cout << "[Vulkan] BindRenderTarget() - Not implemented" << std::endl;
+            }
+
+            void Vulkan::DrawRenderTarget(const RenderTarget& target, float x, float y, float width, float height) {
+                // TODO: Sample offscreen image as a textured quad
+                std::cout << "[Vulkan] DrawRenderTarget() - Not implemented" << std::endl;
+            }
+
+            const RenderTarget* Vulkan::GetRenderTarget() {
+                return nullptr;
+            }
+
+            void Vulkan::BeginOffscreen(const RenderTarget& target) {
+                // TODO: Begin render pass on the offscreen framebuffer with its own projection
+                std::cout << "[Vulkan] BeginOffscreen() - Not implemented" << std::endl;
+            }
+
+            void Vulkan::EndOffscreen() {
+                // TODO: End the offscreen render pass and resume the previous one
+                std::cout << "[Vulkan] EndOffscreen() - Not implemented" << std::endl;
+            }
+
+            void Vulkan::DrawPremultiplied(const RenderTarget& target, float x, float y, float width, float height) {
+                // TODO: Textured quad with premultiplied alpha blending
+                std::cout << "[Vulkan] DrawPremultiplied() - Not implemented" << std::endl;
+            }
+
+            void Vulkan::SetScissor(const Rect* rect) {
+                // TODO: vkCmdSetScissor on the active command buffer
+                std::cout << "[Vulkan] SetScissor() - Not implemented" << std::endl;
+            }
+
+            bool Vulkan::GetScissor(Rect& rect) {
+                return false;
+            }
+
+            void Vulkan::PushClip(const Rect& rect) {
+                // TODO: Intersect with the current scissor and vkCmdSetScissor
+                std::cout << "[Vulkan] PushClip() - Not implemented" << std::endl;
+            }
+
+            void Vulkan::PopClip() {
+                // TODO: Restore the previous scissor
+            }
+
+            void Vulkan::SetBatchLayer(int layer) {
+                // TODO: Sort quads through a RenderQueue once Vulkan draws anything
+            }
+
+            bool Vulkan::QueueReadback() {
+                // TODO: vkCmdCopyImageToBuffer into a host visible buffer
+                std::cout << "[Vulkan] QueueReadback() - Not implemented" << std::endl;
+                return false;
+            }
+
+            bool Vulkan::CollectReadback(Image& image) {
+                return false;
+            }
+
+            void Vulkan::DrawDiagonalLines(float x, float y, float width, float height, float lineSpacing, float lineWidth, Color color) {
                 // TODO: Draw diagonal lines using Vulkan line primitives or custom shader
                 std::cout << "[Vulkan] DrawDiagonalLines() - Not implemented" << std::endl;
             }
 
-            void Vulkan::DrawRadialLines(float x, float y, float width, float height, float centerX1, float centerY1, float centerX2, float centerY2, int numLines, float lineWidth, IColor* color) {
+            void Vulkan::DrawRadialLines(float x, float y, float width, float height, float centerX1, float centerY1, float centerX2, float centerY2, int numLines, float lineWidth, Color color) {
                 // TODO: Draw radial lines using Vulkan
                 std::cout << "[Vulkan] DrawRadialLines() - Not implemented" << std::endl;
             }
 
-            void Vulkan::DrawVerticalLines(float x, float y, float width, float height, float lineSpacing, float lineWidth, IColor* color) {
+            void Vulkan::DrawVerticalLines(float x, float y, float width, float height, float lineSpacing, float lineWidth, Color color) {
                 // TODO: Draw vertical lines using Vulkan
                 std::cout << "[Vulkan] DrawVerticalLines() - Not implemented" << std::endl;
             }
 
-            void Vulkan::DrawHorizontalLines(float x, float y, float width, float height, float lineSpacing, float lineWidth, IColor* color) {
+            void Vulkan::DrawHorizontalLines(float x, float y, float width, float height, float lineSpacing, float lineWidth, Color color) {
                 // TODO: Draw horizontal lines using Vulkan
                 std::cout << "[Vulkan] DrawHorizontalLines() - Not implemented" << std::endl;
             }
@@ -279,19 +372,24 @@ namespace Engine {
                 std::cout << "[Vulkan] DrawFilmGrain() - Not implemented" << std::endl;
             }
 
-            void Vulkan::DrawRect(float x, float y, float width, float height, IColor* color) {
+            void Vulkan::DrawRect(float x, float y, float width, float height, Color color) {
                 // TODO: Draw filled rectangle using Vulkan
                 // This would typically use a simple vertex buffer with 4 vertices (2 triangles)
                 std::cout << "[Vulkan] DrawRect() - Not implemented" << std::endl;
             }
 
-            void Vulkan::DrawRectWithShadow(float x, float y, float width, float height, IColor* color, float shadowRadius, IColor* shadowColor, float shadowOffsetX, float shadowOffsetY) {
+            void Vulkan::DrawRectWithShadow(float x, float y, float width, float height, Color color, float shadowRadius, Color shadowColor, float shadowOffsetX, float shadowOffsetY) {
                 // TODO: Draw rectangle with shadow using Vulkan
                 // Would require multiple passes or a complex fragment shader
                 std::cout << "[Vulkan] DrawRectWithShadow() - Not implemented" << std::endl;
             }
 
-            void Vulkan::PaintText(const std::string& text, float x, float y, IColor* color) {
+            void Vulkan::DrawShape(const Shape& shape) {
+                // TODO: Signed distance fragment shader on a single quad
+                std::cout << "[Vulkan] DrawShape() - Not implemented" << std::endl;
+            }
+
+            void Vulkan::PaintText(const std::string& text, float x, float y, Color color) {
                 // TODO: Render text using Vulkan
                 // This would typically involve:
                 // 1. Font atlas texture
@@ -300,6 +398,16 @@ namespace Engine {
                 std::cout << "[Vulkan] PaintText('" << text << "') - Not implemented" << std::endl;
             }
 
+            void Vulkan::DrawGlyph(unsigned int texture, float x, float y, float width, float height, float u0, float v0, float u1, float v1, Color color, float rotation) {
+                // TODO: Textured quad in a glyph batch
+                std::cout << "[Vulkan] DrawGlyph() - Not implemented" << std::endl;
+            }
+
+            void Vulkan::DrawDistanceGlyph(unsigned int texture, float x, float y, float width, float height, float u0, float v0, float u1, float v1, Color color, float rotation) {
+                // TODO: Glyph batch with a distance threshold fragment shader
+                std::cout << "[Vulkan] DrawDistanceGlyph() - Not implemented" << std::endl;
+            }
+
             // Static methods for backwards compatibility
             void Vulkan::Shutdown() {
                 if (initialized) {
@@ -46,6 +46,7 @@ namespace Engine {
                 // Implementations for the pure virtual functions
                 bool Available() override;
                 std::string GetVersion() override;
+                std::vector<std::string> GetFeatures() override;
                 void CreateDevice() override;
                 void GetDevice() override;
                 void CreateContext() override;
@@ -58,7 +59,7 @@ namespace Engine {
 
                 // Rendering operations
                 void Clear() override;
-                void Clear(IColor* color = new RGBA(0, 0, 0, 100)) override;
+                void Clear(Color color = Color(0, 0, 0, 100)) override;
                 void SwapBuffers() override;
 
                 // 2D rendering setup
@@ -66,22 +67,50 @@ namespace Engine {
                 void End2D() override;
 
                 Texture LoadTexture(const std::string& path) override;
+                Texture CreateTexture(const Image& image) override;
+                void DestroyTexture(Texture& texture) override;
 
                 // Texture drawing
                 void DrawTexture(const Texture& texture, float x, float y, float width, float height) override;
                 void DrawTextureBlurred(const Texture& texture, float x, float y, float width, float height, float blurRadius = 2.0f) override;
 
+                // Offscreen rendering
+                RenderTarget CreateRenderTarget(int width, int height) override;
+                void DestroyRenderTarget(RenderTarget& target) override;
+                void BindRenderTarget(const RenderTarget* target) override;
+                void DrawRenderTarget(const RenderTarget& target, float x, float y, float width, float height) override;
+                const RenderTarget* GetRenderTarget() override;
+                void BeginOffscreen(const RenderTarget& target) override;
+                void EndOffscreen() override;
+                void DrawPremultiplied(const RenderTarget& target, float x, float y, float width, float height) override;
+
+                // Scissor
+                void SetScissor(const Rect* rect) override;
+                bool GetScissor(Rect& rect) override;
+                void PushClip(const Rect& rect) override;
+                void PopClip() override;
+
+                // Render queue
+                void SetBatchLayer(int layer) override;
+
+                // Framebuffer readback
+                bool QueueReadback() override;
+                bool CollectReadback(Image& image) override;
+
                 // Overlay effects
-                void DrawDiagonalLines(float x, float y, float width, float height, float lineSpacing = 10.0f, float lineWidth = 1.0f, IColor* color = new RGBA(255, 255, 255, 10)) override;
-                void DrawRadialLines(float x, float y, float width, float height, float centerX1, float centerY1, float centerX2, float centerY2, int numLines = 20, float lineWidth = 1.0f, IColor* color = new RGBA(255, 255, 255, 10)) override;
-                void DrawVerticalLines(float x, float y, float width, float height, float lineSpacing = 15.0f, float lineWidth = 1.0f, IColor* color = new RGBA(255, 255, 255, 8)) override;
-                void DrawHorizontalLines(float x, float y, float width, float height, float lineSpacing = 15.0f, float lineWidth = 1.0f, IColor* color = new RGBA(255, 255, 255, 8)) override;
+                void DrawDiagonalLines(float x, float y, float width, float height, float lineSpacing = 10.0f, float lineWidth = 1.0f, Color color = Color(255, 255, 255, 10)) override;
+                void DrawRadialLines(float x, float y, float width, float height, float centerX1, float centerY1, float centerX2, float centerY2, int numLines = 20, float lineWidth = 1.0f, Color color = Color(255, 255, 255, 10)) override;
+                void DrawVerticalLines(float x, float y, float width, float height, float lineSpacing = 15.0f, float lineWidth = 1.0f, Color color = Color(255, 255, 255, 8)) override;
+                void DrawHorizontalLines(float x, float y, float width, float height, float lineSpacing = 15.0f, float lineWidth = 1.0f, Color color = Color(255, 255, 255, 8)) override;
                 void DrawFilmGrain(float x, float y, float width, float height, float intensity = 0.08f, int seed = 0) override;
 
                 // Primitive drawing
-                void DrawRect(float x, float y, float width, float height, IColor* color) override;
-                void DrawRectWithShadow(float x, float y, float width, float height, IColor* color, float shadowRadius, IColor* shadowColor, float shadowOffsetX = 0.0f, float shadowOffsetY = 0.0f) override;
-                void PaintText(const std::string& text, float x, float y, IColor* color) override;
+                void DrawRect(float x, float y, float width, float height, Color color) override;
+                void DrawRectWithShadow(float x, float y, float width, float height, Color color, float shadowRadius, Color shadowColor, float shadowOffsetX = 0.0f, float shadowOffsetY = 0.0f) override;
+                void DrawShape(const Shape& shape) override;
+                void PaintText(const std::string& text, float x, float y, Color color) override;
+                void DrawGlyph(unsigned int texture, float x, float y, float width, float height, float u0, float v0, float u1, float v1, Color color, float rotation = 0.0f) override;
+                void DrawDistanceGlyph(unsigned int texture, float x, float y, float width, float height, float u0, float v0, float u1, float v1, Color color, float rotation = 0.0f) override;
 
                 // Static methods for backwards compatibility
                 static void Shutdown();
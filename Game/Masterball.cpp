@@ -1,5 +1,7 @@
 #include "Masterball.h"
 #include "Event.h"
+#include <ctime>
+#include <filesystem>
 
 using Engine::Config;
 using Engine::EngineOption;
@@ -25,6 +27,9 @@ void Masterball::OnInit() {
 
     if(GetOption<MB, bool>(MB::DEBUGGING, false)) {
         std::cout << "[Masterball] Debug ON" << std::endl;
+
+        /* Visualize redrawn regions */
+        GetViewManager().SetDebugDamage(true);
     } else {
         std::cout << "[Masterball] Debug OFF" << std::endl;
     }
@@ -44,6 +49,16 @@ void Masterball::OnInit() {
             SetOption<EngineOption, bool>(EngineOption::VSYNC, Config::GetBool("Render.VSync", true));
         }
 
+        /* Render on a dedicated thread */
+        if(Config::Has("Render.RenderThread")) {
+            SetOption<EngineOption, bool>(EngineOption::RENDER_THREAD, Config::GetBool("Render.RenderThread", false));
+        }
+
+        /* Late-latch input right before rendering */
+        if(Config::Has("Render.LowLatency")) {
+            SetOption<EngineOption, bool>(EngineOption::LOW_LATENCY, Config::GetBool("Render.LowLatency", false));
+        }
+
         /* Enable FPS-Limit */
         if(Config::Has("Render.FrameRateLimiterEnable")) {
             SetOption<EngineOption, bool>(EngineOption::FRAMERATE_LIMIT_ENABLED, Config::GetBool("Render.FrameRateLimiterEnable", false));
@@ -92,6 +107,11 @@ void Masterball::OnInit() {
     /* Register Fonts */
     RegisterFont("Sansation", "../Game/Assets/Fonts/Sansation-Regular.ttf");
 
+    /* Render statistics HUD */
+    if(GetOption<MB, bool>(MB::DEBUGGING, false)) {
+        GetViewManager().SetStatsOverlay(true, "Sansation");
+    }
+
     shutdown = std::make_shared<::Shutdown>();
     loading = std::make_shared<Loading>();
     playing = std::make_shared<Playing>();
@@ -133,6 +153,18 @@ void Masterball::OnInit() {
         }
     });
 
+    /* Screenshot (F12) */
+    ::Engine::Input::GetInput().BindKey(::Engine::Input::KEY::F12, ::Engine::Input::KeyAction::PRESS, [this](::Engine::Input::KEY, ::Engine::Input::KeyAction) {
+        char name[64];
+        std::time_t now = std::time(nullptr);
+        std::strftime(name, sizeof(name), "Screenshots/screenshot_%Y%m%d_%H%M%S.png", std::localtime(&now));
+
+        std::error_code error;
+        std::filesystem::create_directories("Screenshots", error);
+        GetViewManager().GetFrameCapture().Screenshot(name);
+        std::cout << "[Masterball] Screenshot: " << name << std::endl;
+    });
+
     DispatchEvent(ViewChangeEvent("Loading"));
 }
 
@@ -1,6 +1,5 @@
 #pragma once
-#include "../Engine/Graphics/RGBA.h"
-#include <memory>
+#include "../Engine/Graphics/Color.h"
 
 enum class MB {
     TYPE        = 1,
@@ -13,28 +12,25 @@ enum class MB {
     DEBUGGING   = boolean
 */
 
-// Global UI Colors - prevents memory leaks by reusing color objects
+// Global UI Colors - plain values, nothing to allocate or free
 namespace UIColors {
     // Score table colors
-    extern std::unique_ptr<Engine::Graphics::RGBA> headerBgColor;
-    extern std::unique_ptr<Engine::Graphics::RGBA> headerTextColor;
-    extern std::unique_ptr<Engine::Graphics::RGBA> rowBgColor1;
-    extern std::unique_ptr<Engine::Graphics::RGBA> rowBgColor2;
-    extern std::unique_ptr<Engine::Graphics::RGBA> rowTextColor;
+    extern const Engine::Graphics::Color headerBgColor;
+    extern const Engine::Graphics::Color headerTextColor;
+    extern const Engine::Graphics::Color rowBgColor1;
+    extern const Engine::Graphics::Color rowBgColor2;
+    extern const Engine::Graphics::Color rowTextColor;
     
     // Team colors for TEAM_DEATHMATCH mode
-    extern std::unique_ptr<Engine::Graphics::RGBA> teamRedColor;
-    extern std::unique_ptr<Engine::Graphics::RGBA> teamBlueColor;
-    extern std::unique_ptr<Engine::Graphics::RGBA> teamGreenColor;
-    extern std::unique_ptr<Engine::Graphics::RGBA> teamYellowColor;
-    extern std::unique_ptr<Engine::Graphics::RGBA> teamPurpleColor;
-    extern std::unique_ptr<Engine::Graphics::RGBA> teamOrangeColor;
-    extern std::unique_ptr<Engine::Graphics::RGBA> teamCyanColor;
-    extern std::unique_ptr<Engine::Graphics::RGBA> teamPinkColor;
-    
-    // Initialize all global colors
-    void InitializeColors();
+    extern const Engine::Graphics::Color teamRedColor;
+    extern const Engine::Graphics::Color teamBlueColor;
+    extern const Engine::Graphics::Color teamGreenColor;
+    extern const Engine::Graphics::Color teamYellowColor;
+    extern const Engine::Graphics::Color teamPurpleColor;
+    extern const Engine::Graphics::Color teamOrangeColor;
+    extern const Engine::Graphics::Color teamCyanColor;
+    extern const Engine::Graphics::Color teamPinkColor;
     
     // Get team color by index
-    Engine::Graphics::RGBA* GetTeamColor(int teamIndex);
+    Engine::Graphics::Color GetTeamColor(int teamIndex);
 }
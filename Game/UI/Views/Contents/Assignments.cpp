@@ -5,14 +5,14 @@ Assignments::Assignments() {
     titleText.SetValue("ASSIGNMENTS");
     titleText.SetFont("Sansation");
     titleText.SetSize(28.0f);
-    titleText.SetColor(new Engine::Graphics::RGBA(255, 255, 255, 255));
+    titleText.SetColor(Engine::Graphics::Color(255, 255, 255, 100));
     titleText.SetStyle(Engine::Graphics::FontStyle::BOLD | Engine::Graphics::FontStyle::UPPERCASE);
     titleText.SetPadding(10.0f, 10.0f);
 
     assignmentText.SetValue("Active Assignments:\n\n• Collect 5 power-ups\n• Reach level 6\n• Defeat the boss\n• Complete mission in under 10 minutes");
     assignmentText.SetFont("Sansation");
     assignmentText.SetSize(18.0f);
-    assignmentText.SetColor(new Engine::Graphics::RGBA(220, 220, 220, 255));
+    assignmentText.SetColor(Engine::Graphics::Color(220, 220, 220, 100));
     assignmentText.SetPadding(15.0f, 10.0f);
 }
 
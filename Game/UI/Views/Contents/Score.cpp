@@ -1,15 +1,9 @@
 #include "Score.h"
 #include "../../../../Engine/Graphics/IRenderingAPI.h"
-#include "../../../../Engine/Graphics/RGBA.h"
 #include "../../../Options.h"
 #include <algorithm>
 
 Score::Score() : gameMode(SINGLEPLAYER) {
-    // Initialize global colors if not already done
-    if (!UIColors::headerBgColor) {
-        UIColors::InitializeColors();
-    }
-    
     SetGameMode(TEAM_DEATHMATCH, 4);
 }
 
@@ -27,12 +21,12 @@ void Score::SetupSingleplayerTable() {
     singleTable = std::make_unique<Table>();
 
     // Customize table appearance using global colors
-    singleTable->SetStyle(Table::HEADER_BACKGROUND, UIColors::headerBgColor.get());
-    singleTable->SetStyle(Table::HEADER_TEXT_COLOR, UIColors::headerTextColor.get());
+    singleTable->SetStyle(Table::HEADER_BACKGROUND, UIColors::headerBgColor);
+    singleTable->SetStyle(Table::HEADER_TEXT_COLOR, UIColors::headerTextColor);
     singleTable->SetStyle(Table::HEADER_TEXT_STYLE, Engine::Graphics::FontStyle::BOLD | Engine::Graphics::FontStyle::UPPERCASE);
-    singleTable->SetStyle(Table::ROW_BACKGROUND, UIColors::rowBgColor1.get());
-    singleTable->SetStyle(Table::ROW_ALT_BACKGROUND, UIColors::rowBgColor2.get());
-    singleTable->SetStyle(Table::ROW_TEXT_COLOR, UIColors::rowTextColor.get());
+    singleTable->SetStyle(Table::ROW_BACKGROUND, UIColors::rowBgColor1);
+    singleTable->SetStyle(Table::ROW_ALT_BACKGROUND, UIColors::rowBgColor2);
+    singleTable->SetStyle(Table::ROW_TEXT_COLOR, UIColors::rowTextColor);
     singleTable->SetStyle(Table::ROW_TEXT_STYLE, Engine::Graphics::FontStyle::NORMAL);
 
     singleTable->SetRowHeight(25.0f);
@@ -73,11 +67,11 @@ void Score::SetupTeamDeathmatchTables(int teamCount) {
 
         // Customize each team table with team-specific header color using global colors
         table->SetStyle(Table::HEADER_BACKGROUND, UIColors::GetTeamColor(i));
-        table->SetStyle(Table::HEADER_TEXT_COLOR, UIColors::headerTextColor.get());
+        table->SetStyle(Table::HEADER_TEXT_COLOR, UIColors::headerTextColor);
         table->SetStyle(Table::HEADER_TEXT_STYLE, Engine::Graphics::FontStyle::BOLD | Engine::Graphics::FontStyle::UPPERCASE);
-        table->SetStyle(Table::ROW_BACKGROUND, UIColors::rowBgColor2.get()); // 50
-        table->SetStyle(Table::ROW_ALT_BACKGROUND, UIColors::rowBgColor1.get()); // 30
-        table->SetStyle(Table::ROW_TEXT_COLOR, UIColors::rowTextColor.get());
+        table->SetStyle(Table::ROW_BACKGROUND, UIColors::rowBgColor2); // 50
+        table->SetStyle(Table::ROW_ALT_BACKGROUND, UIColors::rowBgColor1); // 30
+        table->SetStyle(Table::ROW_TEXT_COLOR, UIColors::rowTextColor);
         table->SetStyle(Table::ROW_TEXT_STYLE, Engine::Graphics::FontStyle::NORMAL);
 
         table->SetRowHeight(22.0f);
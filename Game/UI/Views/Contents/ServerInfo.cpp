@@ -5,14 +5,14 @@ ServerInfo::ServerInfo() {
     titleText.SetValue("SERVER INFO");
     titleText.SetFont("Sansation");
     titleText.SetSize(28.0f);
-    titleText.SetColor(new Engine::Graphics::RGBA(255, 255, 255, 255));
+    titleText.SetColor(Engine::Graphics::Color(255, 255, 255, 100));
     titleText.SetStyle(Engine::Graphics::FontStyle::BOLD | Engine::Graphics::FontStyle::UPPERCASE);
     titleText.SetPadding(10.0f, 10.0f);
 
     serverText.SetValue("Server: Game Server #1\nStatus: Online\nPlayers: 24/32\nPing: 45ms\nUptime: 2d 14h 23m\n\nServer Region: Europe\nGame Mode: Standard");
     serverText.SetFont("Sansation");
     serverText.SetSize(18.0f);
-    serverText.SetColor(new Engine::Graphics::RGBA(220, 220, 220, 255));
+    serverText.SetColor(Engine::Graphics::Color(220, 220, 220, 100));
     serverText.SetPadding(15.0f, 10.0f);
 }
 
@@ -1,16 +1,18 @@
 #include "Loading.h"
 #include "../../../Engine/Graphics/IRenderingAPI.h"
 #include "../../../Engine/Graphics/Effects/AllEffects.h"
+#include <iostream>
 
 Loading::Loading() : Engine::View("Loading") {
     SetBackground(color_background);
     SetReferenceResolution(1280.0f, 720.0f);
+    SetDamageTracking(true);
 
     /* Text: Map */
     text_map.SetValue(this->mapName);
     text_map.SetFont("Sansation");
     text_map.SetColor(text_color);
-    text_map.SetBackground(new Engine::Graphics::RGBA(0, 0, 0, 40));
+    text_map.SetBackground(Engine::Graphics::Color(0, 0, 0, 40));
     text_map.SetPadding(10.0f, 5.0f);
     text_map.SetSize(40.0f);
     text_map.SetStyle(Engine::Graphics::FontStyle::BOLD | Engine::Graphics::FontStyle::UPPERCASE);
@@ -19,7 +21,7 @@ Loading::Loading() : Engine::View("Loading") {
     text_mode.SetValue(this->gameMode);
     text_mode.SetFont("Sansation");
     text_mode.SetColor(text_color);
-    text_mode.SetBackground(new Engine::Graphics::RGBA(0, 0, 0, 40));
+    text_mode.SetBackground(Engine::Graphics::Color(0, 0, 0, 40));
     text_mode.SetPadding(10.0f, 5.0f);
     text_mode.SetSize(20.0f);
     text_mode.SetStyle(Engine::Graphics::FontStyle::UPPERCASE);
@@ -31,15 +33,27 @@ Loading::Loading() : Engine::View("Loading") {
     text_status.SetSize(20.0f);
     text_status.SetMargin(0.0f, 30.0f + 18.0f + 10.0f, 20.0f, 0.0f);
     text_status.SetStyle(Engine::Graphics::FontStyle::UPPERCASE);
-    //text_status.SetShadow(10.0f, new Engine::Graphics::RGBA(188, 228, 255, 50), 0.0f, 0.0f);
+    //text_status.SetShadow(10.0f, Engine::Graphics::Color(188, 228, 255, 50), 0.0f, 0.0f);
     text_status.GetAnimator().AddEffect(Engine::Graphics::Effects::CreateAmbience(0.8f));
 
     /* Box: Loader */
     box.SetSize(18, 18);
     box.SetMargin(0.0f, 30.0f, 24.0f, 0.0f);
-    box.SetShadow(10.0f, new Engine::Graphics::RGBA(188, 228, 255, 50), 0.0f, 0.0f);
+    box.SetShadow(10.0f, Engine::Graphics::Color(188, 228, 255, 50), 0.0f, 0.0f);
     box.SetColor(text_color);
     box.GetAnimator().AddEffect(Engine::Graphics::Effects::CreateBlink(1.5f));
+
+    /* Background: blurred, scanlines, dimmed by 20% black and sparse grain */
+    backgroundEffects.Add<Engine::Graphics::BlurPass>(5);
+    backgroundEffects.Add<Engine::Graphics::ScanlinePass>(3.0f, 4.0f, Engine::Graphics::Color(0, 0, 0, 30));
+    backgroundEffects.Add<Engine::Graphics::ColorGradePass>(0.8f);
+    backgroundEffects.Add<Engine::Graphics::GrainPass>(0.15f, 123, 0.0002f);
+}
+
+Loading::~Loading() {
+    if(backgroundOwner) {
+        backgroundOwner->DestroyTexture(backgroundTexture);
+    }
 }
 
 void Loading::OnShow() {}
@@ -70,6 +84,40 @@ void Loading::OnUpdateProgress(const std::string& message, int actual, int total
     box.GetAnimator().AddEffect(std::make_unique<Engine::Graphics::Effects::TravelEffect>(0.8f, 180.0f, 4.2f));
 }
 
+void Loading::UpdateBackground(Engine::Graphics::IRenderingAPI& context, const std::string& file, int width, int height) {
+    bool reload = file != backgroundFile;
+
+    if(!reload && backgroundTexture.id != 0 && backgroundTexture.width == width && backgroundTexture.height == height) {
+        return;
+    }
+
+    if(reload) {
+        backgroundFile = file;
+        backgroundSource = Engine::Graphics::Image{};
+
+        if(!Engine::Graphics::Image::Load("../Game/" + file, backgroundSource)) {
+            std::cout << "[Loading] Can't read background " << file << std::endl;
+        }
+    }
+
+    Engine::Graphics::Image processed;
+    backgroundEffects.Apply(backgroundSource, width, height, processed);
+
+    if(backgroundOwner) {
+        backgroundOwner->DestroyTexture(backgroundTexture);
+    }
+
+    backgroundTexture = context.CreateTexture(processed);
+    backgroundOwner = &context;
+}
+
+void Loading::OnCollectDamage(Engine::Graphics::DamageRegion& damage) {
+    text_map.CollectDamage(damage);
+    text_mode.CollectDamage(damage);
+    text_status.CollectDamage(damage);
+    box.CollectDamage(damage);
+}
+
 void Loading::Render(Engine::Graphics::IRenderingAPI& context) {
     context.Clear(GetBackground());
 
@@ -77,16 +125,19 @@ void Loading::Render(Engine::Graphics::IRenderingAPI& context) {
     float h = static_cast<float>(context.GetHeight());
     context.Begin2D(context.GetWidth(), context.GetHeight());
 
-    /* Background */
+    /* Background (cached until resize or background change) */
     std::string file = GetBackgroundImage();
 
     if(!file.empty()) {
-        static auto texture = context.LoadTexture("../Game/" + file);
+        RenderLayer(context, "background", [this, &file, w, h](Engine::Graphics::IRenderingAPI& layer) {
+            UpdateBackground(layer, file, static_cast<int>(w), static_cast<int>(h));
+
+            layer.Clear(GetBackground());
 
-        context.DrawTextureBlurred(texture, 0.0f, 1.0f, w, h, 5.0f);
-        context.DrawHorizontalLines(0.0f, 0.0f, w, h, 3.0f, 4.0f, new Engine::Graphics::RGBA(0, 0, 0, 30));
-        context.DrawRect(0.0f, 0.0f, w, h, new Engine::Graphics::RGBA(0, 0, 0, 20));
-        context.DrawFilmGrain(0.0f, 0.0f, w, h, 0.15f, 123);
+            if(backgroundTexture.id != 0) {
+                layer.DrawTexture(backgroundTexture, 0.0f, 0.0f, w, h);
+            }
+        });
     }
 
     text_map.Render(context, GetScaledX(20.0f), GetScaledY(30.0f));
@@ -2,6 +2,7 @@
 #include "../../../Engine/Core/View.h"
 #include "../../../Engine/Graphics/UI/Text/Text.h"
 #include "../../../Engine/Graphics/UI/Box/Box.h"
+#include "../../../Engine/Graphics/PostProcess.h"
 
 namespace Engine {
     namespace Graphics {
@@ -12,6 +13,7 @@ namespace Engine {
 class Loading : public Engine::View {
     public:
         Loading();
+        ~Loading() override;
 
         void OnShow() override;
         void OnHide() override;
@@ -24,15 +26,25 @@ class Loading : public Engine::View {
 
     protected:
         void Render(Engine::Graphics::IRenderingAPI& renderingAPI) override;
+        void OnCollectDamage(Engine::Graphics::DamageRegion& damage) override;
 
     private:
+        // Runs the background effects again when the file or size changed
+        void UpdateBackground(Engine::Graphics::IRenderingAPI& context, const std::string& file, int width, int height);
+
         Engine::Graphics::Text text_map;
         Engine::Graphics::Text text_mode;
         Engine::Graphics::Text text_status;
         Engine::Graphics::Box box;
-        Engine::Graphics::IColor* text_color       = new Engine::Graphics::HEX("#FEFEFE");
-        Engine::Graphics::IColor* color_background = new Engine::Graphics::HEX("#333333");
+        Engine::Graphics::Color text_color       = Engine::Graphics::Color::FromHex("#FEFEFE");
+        Engine::Graphics::Color color_background = Engine::Graphics::Color::FromHex("#333333");
 
         std::string mapName     = "MAP";
         std::string gameMode    = "MODE";
+
+        Engine::Graphics::PostProcess backgroundEffects;
+        Engine::Graphics::Image backgroundSource;
+        Engine::Graphics::Texture backgroundTexture{};
+        Engine::Graphics::IRenderingAPI* backgroundOwner = nullptr;   // Context the texture was created on
+        std::string backgroundFile;
 };
@@ -7,15 +7,17 @@
 Overlay::Overlay() : Engine::View("Overlay"), currentContent(""), contentScrollY(0.0f) {
     SetBackground(color_background);
     SetReferenceResolution(1280.0f, 720.0f);
+    SetDamageTracking(true);
 
     overlayText.SetValue("GAME MENU");
     overlayText.SetFont("Sansation");
     overlayText.SetColor(text_color);
-    overlayText.SetBackground(new Engine::Graphics::RGBA(0, 0, 0, 30));
+    overlayText.SetBackground(Engine::Graphics::Color(0, 0, 0, 30));
     overlayText.SetPadding(10.0f, 5.0f);
     overlayText.SetMargin(30.0f, 0.0f, 0.0f, 60.0f);
     overlayText.SetSize(40.0f);
     overlayText.SetStyle(Engine::Graphics::FontStyle::BOLD | Engine::Graphics::FontStyle::UPPERCASE);
+    overlayText.SetCached(true);
 
     // Setup menu buttons
     gameMenu.AddButton("Resume", "resume");
@@ -106,11 +108,28 @@ void Overlay::OnMouseScroll(float x, float y) {
             if (contentScrollY > 0) {
                 contentScrollY = 0;
             }
+
+            RequestRedraw();
         }
     }
 }
 
 
+void Overlay::OnCollectDamage(Engine::Graphics::DamageRegion& damage) {
+    overlayText.CollectDamage(damage);
+    gameMenu.CollectDamage(damage);
+
+    // Content pages keep their own texts/tables, repaint the content area while one is open
+    if (!currentContent.empty()) {
+        damage.Add(contentBounds);
+    }
+}
+
+void Overlay::OnLatchInput(float x, float y) {
+    // Hover follows the cursor of this frame, not the last forwarded move event
+    gameMenu.OnMouseMove(x, y);
+}
+
 void Overlay::Render(Engine::Graphics::IRenderingAPI& context) {
     context.Begin2D(context.GetWidth(), context.GetHeight());
     context.DrawRect(0, 0, context.GetWidth(), context.GetHeight(), GetBackground());
@@ -131,8 +150,11 @@ void Overlay::Render(Engine::Graphics::IRenderingAPI& context) {
         float contentY = 100.0f;
         float contentWidth = context.GetWidth() - contentX - 60.0f;
         float contentHeight = context.GetHeight() - contentY - 60.0f;
+        contentBounds = Engine::Graphics::Rect(contentX, contentY, contentWidth, contentHeight);
+
+        // Clip scrollable content to its area, widgets skip what is scrolled out
+        context.PushClip(contentBounds);
 
-        // Set up clipping area for scrollable content
         // Apply scroll offset to content rendering position
         float scrolledContentY = contentY + contentScrollY + 20.0f; // Add padding
         float scrolledContentX = contentX + 20.0f; // Add padding
@@ -150,6 +172,8 @@ void Overlay::Render(Engine::Graphics::IRenderingAPI& context) {
             serverInfoContent->Render(context, scrolledContentX, scrolledContentY, scrolledContentWidth, scrolledContentHeight);
         }
 
+        context.PopClip();
+
         // Draw scrollbar if needed
         // Simple scrollbar on the right side of the content area
         float scrollbarWidth = 10.0f;
@@ -159,14 +183,14 @@ void Overlay::Render(Engine::Graphics::IRenderingAPI& context) {
 
         // Draw scrollbar background
         context.DrawRect(scrollbarX, scrollbarY, scrollbarWidth, scrollbarHeight,
-                        new Engine::Graphics::RGBA(64, 64, 64, 100));
+                        Engine::Graphics::Color(64, 64, 64, 100));
 
         // Draw scrollbar thumb (simplified - always show for now)
         if (contentScrollY < 0) {
             float thumbHeight = scrollbarHeight * 0.3f; // Approximate thumb size
             float thumbY = scrollbarY + (-contentScrollY / 500.0f) * (scrollbarHeight - thumbHeight);
             context.DrawRect(scrollbarX + 1, thumbY, scrollbarWidth - 2, thumbHeight,
-                            new Engine::Graphics::RGBA(128, 128, 128, 180));
+                            Engine::Graphics::Color(128, 128, 128, 180));
         }
     }
 
@@ -176,5 +200,6 @@ void Overlay::Render(Engine::Graphics::IRenderingAPI& context) {
 void Overlay::ShowContent(const std::string& contentType) {
     currentContent = contentType;
     contentScrollY = 0.0f; // Reset scroll position when switching content
+    RequestRedraw();
 }
 
@@ -32,16 +32,19 @@ class Overlay : public Engine::View {
 
     protected:
         void Render(Engine::Graphics::IRenderingAPI& renderingAPI) override;
+        void OnCollectDamage(Engine::Graphics::DamageRegion& damage) override;
+        void OnLatchInput(float x, float y) override;
 
     private:
         Engine::Graphics::Text overlayText;
         Engine::Graphics::Menu gameMenu;
-        Engine::Graphics::IColor* text_color        = new Engine::Graphics::HEX("#FFFFFF");
-        Engine::Graphics::IColor* color_background  = new Engine::Graphics::RGBA(0, 0, 0, 50);
+        Engine::Graphics::Color text_color        = Engine::Graphics::Color::FromHex("#FFFFFF");
+        Engine::Graphics::Color color_background  = Engine::Graphics::Color(0, 0, 0, 50);
         
         // Content area state
         std::string currentContent;
         float contentScrollY;
+        Engine::Graphics::Rect contentBounds;
         
         // Content instances
         std::unique_ptr<Score> scoreContent;
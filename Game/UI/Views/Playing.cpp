@@ -7,6 +7,7 @@
 Playing::Playing() : Engine::View("Playing") {
     SetBackground(color_background);
     SetReferenceResolution(1280.0f, 720.0f);
+    SetDamageTracking(true);
 
     OnKey(Engine::Input::KEY::ESC, [this]() {
         ToggleOverlay();
@@ -49,7 +50,7 @@ void Playing::ToggleOverlay() {
         if (!gameOverlay) {
             gameOverlay = std::make_shared<Overlay>();
 
-            gameOverlay->SetBackground(new Engine::Graphics::RGBA(0, 0, 0, 65));
+            gameOverlay->SetBackground(Engine::Graphics::Color(0, 0, 0, 65));
             gameOverlay->SetActive(true);
             gameOverlay->SetVisible(true);
         } else {
@@ -74,6 +75,11 @@ void Playing::OnUpdate(float deltaTime) {
     (void)deltaTime; 
 }
 
+void Playing::OnCollectDamage(Engine::Graphics::DamageRegion& damage) {
+    // Static background, only repainted on full redraws
+    (void)damage;
+}
+
 void Playing::Render(Engine::Graphics::IRenderingAPI& context) {
     context.Clear(GetBackground());
 }
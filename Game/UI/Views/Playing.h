@@ -23,10 +23,11 @@ class Playing : public Engine::View {
 
     protected:
         void Render(Engine::Graphics::IRenderingAPI& renderingAPI) override;
+        void OnCollectDamage(Engine::Graphics::DamageRegion& damage) override;
 
     private:
-        Engine::Graphics::IColor* text_color       = new Engine::Graphics::HEX("#444444");
-        Engine::Graphics::IColor* color_background = new Engine::Graphics::HEX("#AAAAAA");
+        Engine::Graphics::Color text_color       = Engine::Graphics::Color::FromHex("#444444");
+        Engine::Graphics::Color color_background = Engine::Graphics::Color::FromHex("#AAAAAA");
 
 
         // Keep reference to overlay to avoid recreation
@@ -5,6 +5,7 @@
 Shutdown::Shutdown() : Engine::View("Shutdown") {
     SetBackground(color_background);
     SetReferenceResolution(1280.0f, 720.0f);
+    SetDamageTracking(true);
 
     /* Text: Loading */
     text_status.SetValue("Exiting");
@@ -13,7 +14,7 @@ Shutdown::Shutdown() : Engine::View("Shutdown") {
     text_status.SetSize(20.0f);
     text_status.SetMargin(0.0f, 30.0f + 18.0f + 10.0f, 20.0f, 0.0f);
     text_status.SetStyle(Engine::Graphics::FontStyle::UPPERCASE);
-    //text_status.SetShadow(10.0f, new Engine::Graphics::RGBA(188, 228, 255, 50), 0.0f, 0.0f);
+    //text_status.SetShadow(10.0f, Engine::Graphics::Color(188, 228, 255, 50), 0.0f, 0.0f);
     text_status.GetAnimator().AddEffect(Engine::Graphics::Effects::CreateAmbience(0.8f));
     text_status.GetAnimator().AddEffect(Engine::Graphics::Effects::CreateFadeIn(0.2f));
     text_status.GetAnimator().AddEffect(Engine::Graphics::Effects::CreateSlideFromLeft(100.0f, 0.3f));
@@ -22,7 +23,7 @@ Shutdown::Shutdown() : Engine::View("Shutdown") {
     /* Box: Loader */
     box.SetSize(18, 18);
     box.SetMargin(0.0f, 30.0f, 24.0f, 0.0f);
-    box.SetShadow(10.0f, new Engine::Graphics::RGBA(188, 228, 255, 50), 0.0f, 0.0f);
+    box.SetShadow(10.0f, Engine::Graphics::Color(188, 228, 255, 50), 0.0f, 0.0f);
     box.SetColor(text_color);
     box.GetAnimator().AddEffect(Engine::Graphics::Effects::CreateBlink(1.5f));
     box.GetAnimator().AddEffect(std::make_unique<Engine::Graphics::Effects::TravelEffect>(0.8f, 180.0f, 4.2f));
@@ -39,6 +40,11 @@ void Shutdown::OnUpdate(float deltaTime) {
     box.Update(deltaTime);
 }
 
+void Shutdown::OnCollectDamage(Engine::Graphics::DamageRegion& damage) {
+    text_status.CollectDamage(damage);
+    box.CollectDamage(damage);
+}
+
 void Shutdown::Render(Engine::Graphics::IRenderingAPI& context) {
     context.Clear(GetBackground());
 
@@ -46,16 +52,21 @@ void Shutdown::Render(Engine::Graphics::IRenderingAPI& context) {
     float h = static_cast<float>(context.GetHeight());
     context.Begin2D(context.GetWidth(), context.GetHeight());
 
-    /* Background */
+    /* Background (cached until resize or background change) */
     std::string file = GetBackgroundImage();
 
     if(!file.empty()) {
-        static auto texture = context.LoadTexture("../Game/" + file);
+        RenderLayer(context, "background", [this, &file, w, h](Engine::Graphics::IRenderingAPI& layer) {
+            static auto texture = layer.LoadTexture("../Game/" + file);
+            static const Engine::Graphics::Color scanlines(0, 0, 0, 30);
+            static const Engine::Graphics::Color dim(0, 0, 0, 20);
 
-        context.DrawTextureBlurred(texture, 0.0f, 1.0f, w, h, 5.0f);
-        context.DrawHorizontalLines(0.0f, 0.0f, w, h, 3.0f, 4.0f, new Engine::Graphics::RGBA(0, 0, 0, 30));
-        context.DrawRect(0.0f, 0.0f, w, h, new Engine::Graphics::RGBA(0, 0, 0, 20));
-        context.DrawFilmGrain(0.0f, 0.0f, w, h, 0.15f, 123);
+            layer.Clear(GetBackground());
+            layer.DrawTextureBlurred(texture, 0.0f, 1.0f, w, h, 5.0f);
+            layer.DrawHorizontalLines(0.0f, 0.0f, w, h, 3.0f, 4.0f, scanlines);
+            layer.DrawRect(0.0f, 0.0f, w, h, dim);
+            layer.DrawFilmGrain(0.0f, 0.0f, w, h, 0.15f, 123);
+        });
     }
 
     text_status.Render(context, Engine::Graphics::TextAlignment::BOTTOM_RIGHT);
@@ -20,10 +20,11 @@ class Shutdown : public Engine::View {
 
     protected:
         void Render(Engine::Graphics::IRenderingAPI& renderingAPI) override;
+        void OnCollectDamage(Engine::Graphics::DamageRegion& damage) override;
 
     private:
         Engine::Graphics::Text text_status;
         Engine::Graphics::Box box;
-        Engine::Graphics::IColor* text_color       = new Engine::Graphics::HEX("#FEFEFE");
-        Engine::Graphics::IColor* color_background = new Engine::Graphics::HEX("#000000");
+        Engine::Graphics::Color text_color       = Engine::Graphics::Color::FromHex("#FEFEFE");
+        Engine::Graphics::Color color_background = Engine::Graphics::Color::FromHex("#000000");
 };
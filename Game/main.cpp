@@ -1,5 +1,9 @@
 #include "Masterball.h"
+#include "../Engine/Core/MemoryTracker.h"
 #include <iostream>
+#include <string>
+#include <cstdlib>
+#include <cerrno>
 
 using Engine::Arguments;
 
@@ -12,6 +16,7 @@ int main(int argc, char* argv[]) {
     arguments.Add("server",    "s");
     arguments.Add("version",   "v");
     arguments.Add("debug",     "d");
+    arguments.Add("alloc-budget");
 
     /* Handle Arguments */
     if(arguments.Parse(argc, argv)) {
@@ -24,6 +29,21 @@ int main(int argc, char* argv[]) {
             game.SetOption<MB, bool>(MB::DEBUGGING, true);
         }
 
+        // Allocations allowed per frame, needs a build with ENGINE_MEMORY_TRACKING
+        if(arguments.Has("alloc-budget")) {
+            std::string value = arguments.Get("alloc-budget");
+            char* end = nullptr;
+            errno = 0;
+            unsigned long long budget = std::strtoull(value.c_str(), &end, 10);
+
+            if(value.empty() || value[0] == '-' || *end != '\0' || errno == ERANGE) {
+                std::cout << "Usage: --alloc-budget <allocations per frame>" << std::endl;
+                return 1;
+            }
+
+            Engine::MemoryTracker::GetInstance().SetFrameBudget(budget);
+        }
+
         if(arguments.Has("server")) {
             game.SetOption<MB, std::string>(MB::TYPE, "SERVER");
         } else if(arguments.Has("connect")) {
@@ -42,5 +62,10 @@ int main(int argc, char* argv[]) {
     /* Run */
     game.Run();
 
+    // Lets CI fail a run that went over the allocation budget
+    if(Engine::MemoryTracker::GetInstance().GetFramesOverBudget() > 0) {
+        return 2;
+    }
+
     return 0;
 }